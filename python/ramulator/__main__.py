@@ -12,6 +12,8 @@ Usage:
     python -m ramulator visualize                        # start the trace visualizer
     python -m ramulator visualize --port 4000            # custom port
     python -m ramulator visualize --dev                  # development server with hot-reload
+    python -m ramulator trace convert in.txt out.bin     # convert a text trace to the binary format
+    python -m ramulator trace convert in.bin out.txt     # ... and back
 """
 
 import runpy
@@ -96,6 +98,10 @@ def main():
         codegen_main(sys.argv[2:])
     elif cmd == "visualize":
         visualize_main(sys.argv[2:])
+    elif cmd == "trace":
+        from ramulator.trace import trace_main
+
+        trace_main(sys.argv[2:])
     elif cmd == "run":
         run_main(sys.argv[2:])
     else:
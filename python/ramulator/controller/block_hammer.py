@@ -17,6 +17,7 @@ class BlockHammer(Component):
     read_buffer_size = Param(int, default=32)
     write_buffer_size = Param(int, default=32)
     priority_buffer_size = Param(int, default=1568)
+    lazy_bank_state = Param(bool, default=False)
     bf_num_filters = Param(int, default=2)
     bf_len_epoch = Param(int, default=64000000)
     bf_ctr_count = Param(int, default=1024)
@@ -17,6 +17,7 @@ class GDDR7(Component):
     read_buffer_size = Param(int, default=32)
     write_buffer_size = Param(int, default=32)
     priority_buffer_size = Param(int, default=1568)
+    lazy_bank_state = Param(bool, default=False)
     rck_mode = Param(str, default='always_on')
     rck_idle_threshold = Param(int, default=32)
     scheduler = Child("scheduler")
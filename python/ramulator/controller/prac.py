@@ -17,6 +17,7 @@ class PRAC(Component):
     read_buffer_size = Param(int, default=32)
     write_buffer_size = Param(int, default=32)
     priority_buffer_size = Param(int, default=1568)
+    lazy_bank_state = Param(bool, default=False)
     abo_threshold = Param(int, default=512)
     abo_act_ns = Param(int, default=180)
     abo_recovery_refs = Param(int, default=4)
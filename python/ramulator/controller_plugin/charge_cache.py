@@ -0,0 +1,19 @@
+###############################################################################
+# AUTO-GENERATED FILE — DO NOT EDIT
+#
+# Generated by: python -m ramulator codegen
+# Source:       src/ramulator/controller/plugin/impl/charge_cache.cpp
+#
+# Regenerate:   python -m ramulator codegen
+###############################################################################
+from ramulator.components import Component
+from ramulator.param import Param
+
+
+class ChargeCache(Component):
+    impl = "ChargeCache"
+    num_entries = Param(int, default=128)
+    associativity = Param(int, default=2)
+    caching_duration_ns = Param(float, default=1000000.0)
+    rcd_reduction_ns = Param(float, default=5.0)
+    ras_reduction_ns = Param(float, default=10.0)
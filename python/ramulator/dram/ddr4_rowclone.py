@@ -0,0 +1,74 @@
+from ramulator.dram.ddr4 import DDR4
+from ramulator.dram.spec import TimingConstraint
+
+
+def _with_fpm_acts(tc):
+    """An RCFPM issues two activations: count it wherever ACT-to-ACT spacing applies."""
+    if tc.preceding == ["ACT"] and tc.following == ["ACT"] and tc.level in ("Rank", "BankGroup"):
+        return TimingConstraint(level=tc.level, preceding=["ACT", "RCFPM"], following=["ACT", "RCFPM"],
+                                latency=tc.latency, window=tc.window, sibling=tc.sibling)
+    return tc
+
+
+class DDR4_RowClone(DDR4):
+    """DDR4 with RowClone in-DRAM bulk copy and initialization.
+
+    RCFPM (Fast Parallel Mode) copies a row into another row of the same
+    subarray with back-to-back activations and leaves the bank precharged;
+    initialization copies from a reserved zero row the same way. Copies
+    across banks use Pipelined Serial Mode: RCSRC streams the open source
+    row over the chip's internal bus while RCDST writes it into the open
+    destination row, one cache line per nCCDL, without touching the
+    channel's data bus.
+    """
+
+    name = "DDR4_RowClone"
+
+    commands = DDR4.commands + ["RCFPM", "RCSRC", "RCDST"]
+
+    # nFPM: ACT-ACT-PRE of one in-subarray copy; nPSM: streaming one row between banks
+    timing_params = DDR4.timing_params + ["nFPM", "nPSM"]
+
+    supported_requests = {
+        "Read": "RD",
+        "Write": "WR",
+        "Copy": "RCFPM",  # Inter-bank copies are issued as RCSRC + RCDST by the controller
+        "Init": "RCFPM",
+    }
+
+    timing_constraints = [_with_fpm_acts(tc) for tc in DDR4.timing_constraints] + [
+        # Rank — FPM activations and precharge
+        TimingConstraint(level="Rank", preceding=["RCFPM"], following=["PREab", "REFab"], latency="nFPM"),
+        TimingConstraint(level="Rank", preceding=["PREab"], following=["RCFPM"], latency="nRP"),
+        TimingConstraint(level="Rank", preceding=["REFab"], following=["RCFPM"], latency="nRFC"),
+        # Rank — PSM transfers occupy the internal bus shared with column accesses
+        TimingConstraint(level="Rank", preceding=["RCSRC", "RCDST"], following=["RD", "RDA", "WR", "WRA"], latency="nPSM"),
+        TimingConstraint(level="Rank", preceding=["RCSRC"], following=["RCSRC"], latency="nPSM"),
+        TimingConstraint(level="Rank", preceding=["RCDST"], following=["RCDST"], latency="nPSM"),
+        TimingConstraint(level="Rank", preceding=["RD", "RDA"], following=["RCSRC", "RCDST"], latency="nCCDL"),
+        TimingConstraint(level="Rank", preceding=["WR", "WRA"], following=["RCSRC", "RCDST"], latency="nCWL + nBL + nWTRL"),
+        TimingConstraint(level="Rank", preceding=["RCSRC"], following=["PREab"], latency="nPSM"),
+        TimingConstraint(level="Rank", preceding=["RCDST"], following=["PREab"], latency="nPSM + nWR"),
+
+        # Bank — FPM
+        TimingConstraint(level="Bank", preceding=["RCFPM"], following=["ACT", "RCFPM"], latency="nFPM"),
+        TimingConstraint(level="Bank", preceding=["ACT"], following=["RCFPM"], latency="nRC"),
+        TimingConstraint(level="Bank", preceding=["PREpb"], following=["RCFPM"], latency="nRP"),
+        TimingConstraint(level="Bank", preceding=["RDA"], following=["RCFPM"], latency="nRTP + nRP"),
+        TimingConstraint(level="Bank", preceding=["WRA"], following=["RCFPM"], latency="nCWL + nBL + nWR + nRP"),
+        # Bank — PSM
+        TimingConstraint(level="Bank", preceding=["ACT"], following=["RCSRC", "RCDST"], latency="nRCD"),
+        TimingConstraint(level="Bank", preceding=["RCSRC", "RCDST"], following=["RD", "RDA", "WR", "WRA", "RCSRC", "RCDST"], latency="nPSM"),
+        TimingConstraint(level="Bank", preceding=["RCSRC"], following=["PREpb"], latency="nPSM"),
+        TimingConstraint(level="Bank", preceding=["RCDST"], following=["PREpb"], latency="nPSM + nWR"),
+    ]
+
+    @classmethod
+    def resolve_secondary_timings(cls, timing_dict, org_dict):
+        super().resolve_secondary_timings(timing_dict, org_dict)
+        timing_dict["nFPM"] = 2 * timing_dict["nRAS"] + timing_dict["nRP"]
+        timing_dict["nPSM"] = org_dict["column"] // cls.internal_prefetch_size * timing_dict["nCCDL"]
+
+
+DDR4_RowClone.org_presets = DDR4.org_presets
+DDR4_RowClone.timing_presets = DDR4.timing_presets
@@ -0,0 +1,65 @@
+from ramulator.dram.ddr4 import DDR4
+from ramulator.dram.spec import TimingConstraint
+
+
+class DDR4_SALP(DDR4):
+    """DDR4 with subarray-level parallelism (SALP, MASA variant).
+
+    Each bank is split into subarrays with their own local row buffers, so
+    rows in different subarrays of one bank can be open at the same time.
+    Row-cycle timings (nRCD, nRAS, nRP, nRC, ...) apply per subarray; PREpb
+    precharges only the addressed subarray. SASEL connects an activated
+    subarray to the bank's global bitlines before a column command (ACT
+    selects the subarray it opens).
+    """
+
+    name = "DDR4_SALP"
+
+    levels = {
+        "Channel":      "N_A",
+        "Rank":         "N_A",
+        "BankGroup":    "N_A",
+        "Bank":         "Closed",
+        "Subarray":     "Closed",
+        "Row":          "Closed",
+        "Column":       "N_A",
+    }
+
+    commands = DDR4.commands + ["SASEL"]
+
+    states = DDR4.states + ["Selected"]
+
+    # nSCD: subarray change delay (SASEL to column command)
+    timing_params = DDR4.timing_params + ["nSCD"]
+
+    timing_constraints = [tc for tc in DDR4.timing_constraints if tc.level != "Bank"] + [
+        # Bank — global bitlines shared by all subarrays
+        TimingConstraint(level="Bank", preceding=["SASEL"], following=["RD", "RDA", "WR", "WRA"], latency="nSCD"),
+        TimingConstraint(level="Bank", preceding=["RD", "RDA"], following=["SASEL"], latency="nCCDL"),
+        TimingConstraint(level="Bank", preceding=["WR", "WRA"], following=["SASEL"], latency="nCWL + nBL"),
+
+        # Subarray — row cycle of one local row buffer
+        TimingConstraint(level="Subarray", preceding=["ACT"], following=["ACT"], latency="nRC"),
+        TimingConstraint(level="Subarray", preceding=["ACT"], following=["RD", "RDA", "WR", "WRA"], latency="nRCD"),
+        TimingConstraint(level="Subarray", preceding=["ACT"], following=["PREpb"], latency="nRAS"),
+        TimingConstraint(level="Subarray", preceding=["PREpb"], following=["ACT"], latency="nRP"),
+        TimingConstraint(level="Subarray", preceding=["RD"], following=["PREpb"], latency="nRTP"),
+        TimingConstraint(level="Subarray", preceding=["WR"], following=["PREpb"], latency="nCWL + nBL + nWR"),
+        TimingConstraint(level="Subarray", preceding=["RDA"], following=["ACT"], latency="nRTP + nRP"),
+        TimingConstraint(level="Subarray", preceding=["WRA"], following=["ACT"], latency="nCWL + nBL + nWR + nRP"),
+    ]
+
+
+# DDR4 presets with each bank split into 8 subarrays (the row count becomes rows per subarray)
+DDR4_SALP.org_presets = {}
+for _name, _org in DDR4.org_presets.items():
+    _salp_org = dict(_org)
+    _salp_org["subarray"] = 8
+    _salp_org["row"] = _org["row"] // 8
+    DDR4_SALP.org_presets[_name] = _salp_org
+
+DDR4_SALP.timing_presets = {}
+for _name, _timings in DDR4.timing_presets.items():
+    _salp_timings = dict(_timings)
+    _salp_timings["nSCD"] = 1
+    DDR4_SALP.timing_presets[_name] = _salp_timings
@@ -10,5 +10,6 @@ from .latency_throughput_trace import LatencyThroughputTrace
 from .load_store_trace import LoadStoreTrace
 from .read_write_trace import ReadWriteTrace
 from .simple_o3 import SimpleO3
+from .timestamped_trace import TimestampedTrace
 
-__all__ = ['BHO3', 'External', 'LatencyThroughputTrace', 'LoadStoreTrace', 'ReadWriteTrace', 'SimpleO3']
+__all__ = ['BHO3', 'External', 'LatencyThroughputTrace', 'LoadStoreTrace', 'ReadWriteTrace', 'SimpleO3', 'TimestampedTrace']
@@ -26,4 +26,5 @@ class BHO3(Component):
     lat_hist_sens = Param(int, default=0)
     dump_path = Param(str, default='')
     attacker_core_ids = Param(list, default=[], cpp_type="std::vector<int>")
+    trace_load_threads = Param(int, default=0)
     translation = Child("translation")
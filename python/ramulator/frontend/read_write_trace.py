@@ -14,3 +14,4 @@ class ReadWriteTrace(Component):
     impl = "ReadWriteTrace"
     clock_ratio = Param(int, required=True, cpp_type="unsigned int")
     path = Param(str, required=True)
+    prefetch = Param(bool, default=True)
@@ -22,4 +22,5 @@ class SimpleO3(Component):
     llc_associativity = Param(int, default=8)
     llc_capacity_per_core = Param(str, default='2MB')
     llc_num_mshr_per_core = Param(int, default=16)
+    trace_load_threads = Param(int, default=0)
     translation = Child("translation")
@@ -0,0 +1,21 @@
+###############################################################################
+# AUTO-GENERATED FILE — DO NOT EDIT
+#
+# Generated by: python -m ramulator codegen
+# Source:       src/ramulator/frontend/impl/memory_trace/timestamped_trace.cpp
+#
+# Regenerate:   python -m ramulator codegen
+###############################################################################
+from ramulator.components import Component
+from ramulator.param import Param
+
+
+class TimestampedTrace(Component):
+    impl = "TimestampedTrace"
+    clock_ratio = Param(int, required=True, cpp_type="unsigned int")
+    path = Param(str, required=True)
+    prefetch = Param(bool, default=True)
+    time_unit = Param(str, default='cycle')
+    time_compression = Param(float, default=1.0)
+    num_sources = Param(int, default=1)
+    latency_dump_path = Param(str, default='')
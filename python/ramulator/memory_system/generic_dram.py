@@ -13,5 +13,7 @@ from ramulator.param import Param, Child, ChildList
 class GenericDRAM(Component):
     impl = "GenericDRAM"
     clock_ratio = Param(int, required=True, cpp_type="unsigned int")
+    fast_forward = Param(bool, default=False)
+    num_threads = Param(int, default=1)
     channel_mapper = Child("channel_mapper")
     controllers = ChildList("controller")
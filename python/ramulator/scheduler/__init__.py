@@ -5,6 +5,7 @@
 # Regenerate:   python -m ramulator codegen
 ###############################################################################
 from .frfcfs import FRFCFS
+from .frfcfs_incremental import FRFCFSIncremental
 from .frfcfs_row_hit import FRFCFSRowHit
 
-__all__ = ['FRFCFS', 'FRFCFSRowHit']
+__all__ = ['FRFCFS', 'FRFCFSIncremental', 'FRFCFSRowHit']
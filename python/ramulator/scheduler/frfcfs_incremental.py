@@ -0,0 +1,13 @@
+###############################################################################
+# AUTO-GENERATED FILE — DO NOT EDIT
+#
+# Generated by: python -m ramulator codegen
+# Source:       src/ramulator/controller/scheduler/impl/frfcfs_incremental.cpp
+#
+# Regenerate:   python -m ramulator codegen
+###############################################################################
+from ramulator.components import Component
+
+
+class FRFCFSIncremental(Component):
+    impl = "FRFCFS-Incremental"
@@ -0,0 +1,344 @@
+"""Binary memory traces: conversion between the text trace formats and the binary format.
+
+The binary format is specified in src/ramulator/frontend/trace/binary_trace.h. It holds the
+records of one text format:
+
+- ``loadstore``: ``LoadStoreTrace`` (``LD <addr>``, ``ST <addr>``, ``ZR <addr>``, ``CP <src> <dst>``)
+- ``readwrite``: ``ReadWriteTrace`` (``R <addr_vec>``, ``W <addr_vec>``)
+- ``inst``: ``SimpleO3``/``BHO3`` (``<bubble_count> <load_addr> [<store_addr>]``)
+
+Every frontend that reads one of these formats recognizes a binary trace by its magic, so a
+converted trace can be used in place of the text one.
+"""
+
+import struct
+
+MAGIC = b"RAMTRACE"
+VERSION = 1
+HEADER = struct.Struct("<8sIBBHIIQQQ")  # 48 bytes
+
+KINDS = {"loadstore": 1, "readwrite": 2, "inst": 3}
+KIND_NAMES = {v: k for k, v in KINDS.items()}
+
+LOADSTORE_OPS = {"LD": 0, "ST": 1, "ZR": 2, "CP": 3}
+LOADSTORE_OP_NAMES = {v: k for k, v in LOADSTORE_OPS.items()}
+
+DEFAULT_BLOCK_RECORDS = 65536
+MAX_ADDR_VEC_SIZE = 7  # AddrVec::kCapacity
+
+_MASK64 = (1 << 64) - 1
+
+
+def is_binary_trace(path):
+    with open(path, "rb") as f:
+        return f.read(len(MAGIC)) == MAGIC
+
+
+# ── Integer coding ────────────────────────────────────────────────────
+
+
+def _zigzag(delta):
+    """Zigzag-encode a delta taken modulo 2^64 (as the C++ reader adds it back)."""
+    delta &= _MASK64
+    if delta >= 1 << 63:
+        delta -= 1 << 64
+    return ((delta << 1) ^ (delta >> 63)) & _MASK64
+
+
+def _unzigzag(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+def _put_varint(out, value):
+    while value >= 0x80:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+
+
+def _get_varint(buf, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = buf[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return value, pos
+        shift += 7
+
+
+def _wrap(value):
+    """Interpret a value modulo 2^64 as a signed 64-bit integer."""
+    value &= _MASK64
+    return value - (1 << 64) if value >= 1 << 63 else value
+
+
+# ── Text parsing (mirrors the C++ frontends) ──────────────────────────
+
+
+def _parse_addr(token, where):
+    try:
+        if token[:2] in ("0x", "0X"):
+            return int(token[2:], 16)
+        return int(token, 10)
+    except ValueError:
+        raise ValueError(f"{where}: invalid address '{token}'") from None
+
+
+def _parse_loadstore(tokens, where):
+    op = LOADSTORE_OPS.get(tokens[0])
+    if op is None:
+        raise ValueError(f"{where}: unknown type '{tokens[0]}' (expected LD, ST, ZR or CP)")
+    expected = 3 if op == LOADSTORE_OPS["CP"] else 2
+    if len(tokens) != expected:
+        raise ValueError(f"{where}: expected {expected} tokens, got {len(tokens)}")
+    if op == LOADSTORE_OPS["CP"]:
+        return op, _parse_addr(tokens[2], where), _parse_addr(tokens[1], where)
+    return op, _parse_addr(tokens[1], where), -1
+
+
+def _parse_readwrite(tokens, where):
+    if len(tokens) != 2:
+        raise ValueError(f"{where}: expected 2 tokens, got {len(tokens)}")
+    if tokens[0] not in ("R", "W"):
+        raise ValueError(f"{where}: unknown type '{tokens[0]}' (expected R or W)")
+    try:
+        addr_vec = [int(t, 10) for t in tokens[1].split(",")]
+    except ValueError:
+        raise ValueError(f"{where}: invalid address vector '{tokens[1]}'") from None
+    return tokens[0] == "W", addr_vec
+
+
+def _parse_inst(tokens, where):
+    if len(tokens) not in (2, 3):
+        raise ValueError(f"{where}: expected 2 or 3 tokens, got {len(tokens)}")
+    try:
+        bubble_count = int(tokens[0], 10)
+    except ValueError:
+        raise ValueError(f"{where}: invalid instruction '{' '.join(tokens)}'") from None
+    load_addr = _parse_addr(tokens[1], where)
+    store_addr = _parse_addr(tokens[2], where) if len(tokens) == 3 else -1
+    return bubble_count, load_addr, store_addr
+
+
+_PARSERS = {"loadstore": _parse_loadstore, "readwrite": _parse_readwrite, "inst": _parse_inst}
+
+
+def detect_kind(path):
+    """Guess the text format of a trace from its first line."""
+    with open(path) as f:
+        first = f.readline().rstrip("\r\n").split(" ")
+    if first[0] in LOADSTORE_OPS:
+        return "loadstore"
+    if first[0] in ("R", "W"):
+        return "readwrite"
+    if first[0].isdigit():
+        return "inst"
+    raise ValueError(f"Cannot tell the format of trace {path} from its first line; pass the kind explicitly")
+
+
+# ── Encoding ──────────────────────────────────────────────────────────
+
+
+class _Encoder:
+    def __init__(self, kind):
+        self.kind = kind
+        self.reset()
+
+    def reset(self):
+        self.prev_addr = 0
+        self.prev_vec = None
+
+    def encode(self, out, record, where):
+        if self.kind == "loadstore":
+            op, addr, src_addr = record
+            zz = _zigzag(addr - self.prev_addr)
+            if zz >= 1 << 62:
+                raise ValueError(f"{where}: address delta too large for the binary format")
+            _put_varint(out, zz << 2 | op)
+            if op == LOADSTORE_OPS["CP"]:
+                _put_varint(out, _zigzag(src_addr - addr))
+            self.prev_addr = addr
+        elif self.kind == "readwrite":
+            is_write, addr_vec = record
+            prev = self.prev_vec or [0] * len(addr_vec)
+            _put_varint(out, _zigzag(addr_vec[0] - prev[0]) << 1 | int(is_write))
+            for value, prev_value in zip(addr_vec[1:], prev[1:]):
+                _put_varint(out, _zigzag(value - prev_value))
+            self.prev_vec = addr_vec
+        else:
+            bubble_count, load_addr, store_addr = record
+            if bubble_count < 0:
+                raise ValueError(f"{where}: negative bubble count")
+            zz = _zigzag(load_addr - self.prev_addr)
+            if zz >= 1 << 63:
+                raise ValueError(f"{where}: address delta too large for the binary format")
+            _put_varint(out, bubble_count)
+            has_store = store_addr != -1
+            _put_varint(out, zz << 1 | int(has_store))
+            if has_store:
+                _put_varint(out, _zigzag(store_addr - load_addr))
+            self.prev_addr = load_addr
+
+
+def text_to_binary(src, dst, kind=None, block_records=DEFAULT_BLOCK_RECORDS):
+    """Convert a text trace into a binary trace. Returns the number of records."""
+    kind = kind or detect_kind(src)
+    parse = _PARSERS[kind]
+    encoder = _Encoder(kind)
+
+    num_records = 0
+    addr_vec_size = 0
+    block_offsets = []
+    block = bytearray()
+    offset = HEADER.size
+
+    with open(src) as fin, open(dst, "wb") as fout:
+        fout.write(b"\0" * HEADER.size)
+        for line_num, line in enumerate(fin, 1):
+            where = f"Trace {src} line {line_num}"
+            record = parse(line.rstrip("\r\n").split(" "), where)
+
+            if kind == "readwrite":
+                if not addr_vec_size:
+                    addr_vec_size = len(record[1])
+                    if addr_vec_size > MAX_ADDR_VEC_SIZE:
+                        raise ValueError(f"{where}: at most {MAX_ADDR_VEC_SIZE} address vector levels are supported")
+                if len(record[1]) != addr_vec_size:
+                    raise ValueError(f"{where}: address vectors must all have {addr_vec_size} levels")
+
+            if num_records % block_records == 0:
+                offset += len(block)
+                fout.write(block)
+                block.clear()
+                block_offsets.append(offset)
+                encoder.reset()
+            encoder.encode(block, record, where)
+            num_records += 1
+
+        fout.write(block)
+        index_offset = offset + len(block)
+        fout.write(struct.pack(f"<{len(block_offsets)}Q", *block_offsets))
+        fout.seek(0)
+        fout.write(
+            HEADER.pack(MAGIC, VERSION, KINDS[kind], addr_vec_size, 0, block_records, 0, num_records,
+                        len(block_offsets), index_offset)
+        )
+    return num_records
+
+
+# ── Decoding ──────────────────────────────────────────────────────────
+
+
+def read_binary_trace(path):
+    """Return (kind, records) of a binary trace, with records as the text parsers produce them."""
+    with open(path, "rb") as f:
+        buf = f.read()
+    (magic, version, kind_id, addr_vec_size, _, block_records, _, num_records, num_blocks,
+     index_offset) = HEADER.unpack_from(buf)
+    if magic != MAGIC:
+        raise ValueError(f"{path} is not a binary trace")
+    if version != VERSION:
+        raise ValueError(f"{path} has binary format version {version}, only version {VERSION} is supported")
+    kind = KIND_NAMES[kind_id]
+    block_offsets = struct.unpack_from(f"<{num_blocks}Q", buf, index_offset)
+
+    records = []
+    for block, pos in enumerate(block_offsets):
+        prev_addr = 0
+        prev_vec = [0] * addr_vec_size
+        for _ in range(min(block_records, num_records - block * block_records)):
+            head, pos = _get_varint(buf, pos)
+            if kind == "loadstore":
+                op = head & 3
+                addr = _wrap(prev_addr + _unzigzag(head >> 2))
+                src_addr = -1
+                if op == LOADSTORE_OPS["CP"]:
+                    delta, pos = _get_varint(buf, pos)
+                    src_addr = _wrap(addr + _unzigzag(delta))
+                records.append((op, addr, src_addr))
+                prev_addr = addr
+            elif kind == "readwrite":
+                vec = [prev_vec[0] + _unzigzag(head >> 1)]
+                for level in range(1, addr_vec_size):
+                    delta, pos = _get_varint(buf, pos)
+                    vec.append(prev_vec[level] + _unzigzag(delta))
+                records.append((bool(head & 1), vec))
+                prev_vec = vec
+            else:
+                bubble_count = head
+                head, pos = _get_varint(buf, pos)
+                load_addr = _wrap(prev_addr + _unzigzag(head >> 1))
+                store_addr = -1
+                if head & 1:
+                    delta, pos = _get_varint(buf, pos)
+                    store_addr = _wrap(load_addr + _unzigzag(delta))
+                records.append((bubble_count, load_addr, store_addr))
+                prev_addr = load_addr
+    return kind, records
+
+
+def _format_record(kind, record):
+    if kind == "loadstore":
+        op, addr, src_addr = record
+        if op == LOADSTORE_OPS["CP"]:
+            return f"CP {hex(src_addr)} {hex(addr)}"
+        return f"{LOADSTORE_OP_NAMES[op]} {hex(addr)}"
+    if kind == "readwrite":
+        is_write, addr_vec = record
+        return f"{'W' if is_write else 'R'} {','.join(map(str, addr_vec))}"
+    bubble_count, load_addr, store_addr = record
+    if store_addr == -1:
+        return f"{bubble_count} {load_addr}"
+    return f"{bubble_count} {load_addr} {store_addr}"
+
+
+def binary_to_text(src, dst):
+    """Convert a binary trace back into its text format. Returns the number of records."""
+    kind, records = read_binary_trace(src)
+    with open(dst, "w") as f:
+        for record in records:
+            f.write(_format_record(kind, record))
+            f.write("\n")
+    return len(records)
+
+
+def convert(src, dst, kind=None, block_records=DEFAULT_BLOCK_RECORDS):
+    """Convert a text trace to binary, or a binary trace back to text."""
+    if is_binary_trace(src):
+        return binary_to_text(src, dst)
+    return text_to_binary(src, dst, kind=kind, block_records=block_records)
+
+
+def trace_main(args):
+    """``python -m ramulator trace convert``."""
+    import argparse
+
+    parser = argparse.ArgumentParser(prog="python -m ramulator trace", description="Memory trace utilities.")
+    sub = parser.add_subparsers(dest="command", required=True)
+    conv = sub.add_parser(
+        "convert",
+        help="Convert a text trace to the binary format (or a binary trace back to text)",
+    )
+    conv.add_argument("input", help="Input trace")
+    conv.add_argument("output", help="Output trace")
+    conv.add_argument(
+        "-k",
+        "--kind",
+        choices=sorted(KINDS),
+        default=None,
+        help="Text format of the input (default: guessed from its first line)",
+    )
+    conv.add_argument(
+        "--block-records",
+        type=int,
+        default=DEFAULT_BLOCK_RECORDS,
+        help=f"Records per seekable block (default: {DEFAULT_BLOCK_RECORDS})",
+    )
+    opts = parser.parse_args(args)
+
+    if opts.block_records <= 0 or opts.block_records >= 1 << 32:
+        parser.error("--block-records must be in [1, 2^32)")
+    num_records = convert(opts.input, opts.output, kind=opts.kind, block_records=opts.block_records)
+    print(f"Converted {num_records} records: {opts.input} -> {opts.output}")
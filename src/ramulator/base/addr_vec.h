@@ -0,0 +1,125 @@
+#ifndef RAMULATOR_BASE_ADDR_VEC_H
+#define RAMULATOR_BASE_ADDR_VEC_H
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace Ramulator {
+
+/**
+ * @brief     Fixed-capacity, inline device address vector
+ *
+ * Drop-in replacement for std::vector<int> on the request path: same indexing,
+ * size/resize/push_back and iteration API, but the storage lives inside the
+ * object, so creating or copying a Request never touches the heap.
+ *
+ * kCapacity covers the deepest supported hierarchy (HBM3/HBM4: Channel,
+ * PseudoChannel, SID, BankGroup, Bank, Row, Column). Growing beyond it throws.
+ */
+class AddrVec {
+ public:
+  static constexpr int kCapacity = 7;
+
+  using value_type = int;
+  using size_type = size_t;
+  using iterator = int*;
+  using const_iterator = const int*;
+
+  AddrVec() = default;
+  AddrVec(size_t count, int value) {
+    resize(count, value);
+  }
+  explicit AddrVec(size_t count) : AddrVec(count, 0) {
+  }
+  AddrVec(std::initializer_list<int> values) {
+    check_capacity(values.size());
+    std::copy(values.begin(), values.end(), m_data);
+    m_size = static_cast<uint8_t>(values.size());
+  }
+  template <std::input_iterator InputIt>
+  AddrVec(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      push_back(static_cast<int>(*first));
+    }
+  }
+
+  int& operator[](size_t i) {
+    return m_data[i];
+  }
+  const int& operator[](size_t i) const {
+    return m_data[i];
+  }
+  int& back() {
+    return m_data[m_size - 1];
+  }
+  const int& back() const {
+    return m_data[m_size - 1];
+  }
+
+  int* data() {
+    return m_data;
+  }
+  const int* data() const {
+    return m_data;
+  }
+  iterator begin() {
+    return m_data;
+  }
+  iterator end() {
+    return m_data + m_size;
+  }
+  const_iterator begin() const {
+    return m_data;
+  }
+  const_iterator end() const {
+    return m_data + m_size;
+  }
+
+  size_t size() const {
+    return m_size;
+  }
+  bool empty() const {
+    return m_size == 0;
+  }
+  static constexpr size_t capacity() {
+    return kCapacity;
+  }
+
+  void resize(size_t count, int value = 0) {
+    check_capacity(count);
+    if (count > m_size) {
+      std::fill(m_data + m_size, m_data + count, value);
+    }
+    m_size = static_cast<uint8_t>(count);
+  }
+  void push_back(int value) {
+    check_capacity(m_size + 1);
+    m_data[m_size++] = value;
+  }
+  void clear() {
+    m_size = 0;
+  }
+
+  friend bool operator==(const AddrVec& a, const AddrVec& b) {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end());
+  }
+
+ private:
+  int m_data[kCapacity] = {};
+  uint8_t m_size = 0;
+
+  static void check_capacity(size_t count) {
+    if (count > kCapacity) {
+      throw std::runtime_error("AddrVec: " + std::to_string(count) + " levels exceed the inline capacity of " +
+                               std::to_string(kCapacity));
+    }
+  }
+};
+
+}  // namespace Ramulator
+
+#endif  // RAMULATOR_BASE_ADDR_VEC_H
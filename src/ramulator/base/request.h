@@ -1,8 +1,11 @@
 #ifndef RAMULATOR_BASE_REQUEST_H
 #define RAMULATOR_BASE_REQUEST_H
 
-#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include <new>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -10,15 +13,60 @@
 
 namespace Ramulator {
 
+struct Request;
+
+/**
+ * @brief     Non-allocating completion callback: an invoker function pointer plus inline context
+ *
+ * Any trivially copyable callable of up to kStorageSize bytes (typically a lambda capturing
+ * `this` and a few scalars) is stored inside the handle itself, so setting, copying and invoking
+ * a callback never allocates and Request stays trivially copyable. Callables that own state
+ * (std::function, Python objects) must live elsewhere and be referenced by a token, as
+ * ExternalFrontEnd does.
+ */
+class RequestCallback {
+ public:
+  static constexpr size_t kStorageSize = 16;
+
+  RequestCallback() = default;
+  RequestCallback(std::nullptr_t) {
+  }
+
+  template <typename F>
+    requires(!std::is_same_v<std::decay_t<F>, RequestCallback> && std::is_invocable_v<const F&, Request&>)
+  RequestCallback(const F& fn) {
+    static_assert(std::is_trivially_copyable_v<F> && std::is_trivially_destructible_v<F>,
+                  "RequestCallback only holds trivially copyable callables (capture pointers/ids, not owners)");
+    static_assert(sizeof(F) <= kStorageSize && alignof(F) <= alignof(std::max_align_t),
+                  "RequestCallback callable too large; capture a pointer to the state instead");
+    ::new (static_cast<void*>(m_storage)) F(fn);
+    m_invoke = [](const void* storage, Request& req) { (*std::launder(static_cast<const F*>(storage)))(req); };
+  }
+
+  void operator()(Request& req) const {
+    m_invoke(m_storage, req);
+  }
+
+  explicit operator bool() const {
+    return m_invoke != nullptr;
+  }
+
+ private:
+  void (*m_invoke)(const void*, Request&) = nullptr;
+  alignas(std::max_align_t) unsigned char m_storage[kStorageSize] = {};
+};
+
 struct Request {
   Addr_t addr = -1;
   Addr_t intra_channel_addr = -1;  // Flat address with channel bits stripped
   AddrVec_t addr_vec{};
 
   // Universal built-in external request types — always Read = 0, Write = 1.
-  // Additional non-negative ids may exist as metadata for future extensions.
+  // Copy and Init (RowClone bulk copy/initialization of the row holding addr) are only accepted
+  // by standards that list them in supported_requests. Additional non-negative ids may exist as
+  // metadata for future extensions.
   struct Type {
-    enum : int { Read = 0, Write = 1 };
+    enum : int { Read = 0, Write = 1, Copy = 2, Init = 3 };
   };
 
   int type_id = -1;    // Request type. -1 is the convention for internal maintenance/direct-command requests.
@@ -26,14 +74,29 @@ struct Request {
 
   int size_bytes = -1;     // Request size in bytes. Must be set explicitly by the frontend.
 
+  // Copy requests: the row holding src_addr is copied into the one holding addr. The memory
+  // system strips its channel bits into src_intra_channel_addr (both must map to one channel).
+  Addr_t src_addr = -1;
+  Addr_t src_intra_channel_addr = -1;
+
   int command = -1;        // Current command to issue to progress the request
   int final_command = -1;  // Terminal command needed to complete the request
   bool is_stat_updated = false;
 
+  // Prerequisite of final_command memoized by DRAMDevice::get_preq_command(Request&, Clk_t),
+  // reused while the bank state it was resolved against is unchanged.
+  struct PreqCache {
+    int final_command = -1;  // final_command it was resolved for (-1: empty)
+    int command = -1;        // Resolved prerequisite
+    int flat_bank_id = -1;   // Target bank of a single-bank command, -1 if it depends on all banks
+    uint64_t epoch = 0;      // DRAMDevice::m_state_epoch at resolution
+  };
+  PreqCache preq_cache;
+
   Clk_t arrive = -1;  // Clock cycle when the request arrives at the memory controller
   Clk_t depart = -1;  // Clock cycle when the request departs the memory controller
 
-  std::function<void(Request&)> callback;
+  RequestCallback callback;
 
   // Tag type to disambiguate the internal-command constructor from the type_id one.
   struct Cmd_t {};
@@ -42,10 +105,13 @@ struct Request {
   Request() = default;
   Request(Addr_t addr, int type);
   Request(AddrVec_t addr_vec, int type);
-  Request(Addr_t addr, int type, int source_id, std::function<void(Request&)> callback);
+  Request(Addr_t addr, int type, int source_id, RequestCallback callback);
   Request(AddrVec_t addr_vec, Cmd_t, int final_cmd);  // internal commands (refresh, row close, etc.)
 };
 
+// Requests are copied between buffers on every scheduling step; keep that a plain memcpy.
+static_assert(std::is_trivially_copyable_v<Request>);
+
 }  // namespace Ramulator
 
 #endif  // RAMULATOR_BASE_REQUEST_H
@@ -0,0 +1,73 @@
+#ifndef RAMULATOR_BASE_SPSC_QUEUE_H
+#define RAMULATOR_BASE_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace Ramulator {
+
+/**
+ * @brief     Bounded lock-free queue between exactly one producer and one consumer thread
+ *
+ * Only the producer may push and only the consumer may pop. The try_ variants never block;
+ * push() and pop() sleep on an atomic wait while the queue is full or empty, so an idle side
+ * does not burn a core.
+ */
+template <typename T, size_t Capacity>
+class SpscQueue {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+ public:
+  SpscQueue() = default;
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  bool try_push(T& value) {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) == Capacity) {
+      return false;
+    }
+    m_slots[tail % Capacity] = std::move(value);
+    m_tail.store(tail + 1, std::memory_order_release);
+    m_tail.notify_one();
+    return true;
+  }
+
+  bool try_pop(T& value) {
+    size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+    value = std::move(m_slots[head % Capacity]);
+    m_head.store(head + 1, std::memory_order_release);
+    m_head.notify_one();
+    return true;
+  }
+
+  void push(T value) {
+    while (!try_push(value)) {
+      // Sleep while the consumer has not freed a slot
+      m_head.wait(m_tail.load(std::memory_order_relaxed) - Capacity, std::memory_order_acquire);
+    }
+  }
+
+  T pop() {
+    T value;
+    while (!try_pop(value)) {
+      // Sleep while the producer has not filled a slot
+      m_tail.wait(m_head.load(std::memory_order_relaxed), std::memory_order_acquire);
+    }
+    return value;
+  }
+
+ private:
+  // Monotonic positions; each is written by one side only and kept on its own cache line
+  alignas(64) std::atomic<size_t> m_head{0};
+  alignas(64) std::atomic<size_t> m_tail{0};
+  alignas(64) T m_slots[Capacity];
+};
+
+}  // namespace Ramulator
+
+#endif  // RAMULATOR_BASE_SPSC_QUEUE_H
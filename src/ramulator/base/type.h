@@ -1,15 +1,22 @@
 #ifndef RAMULATOR_BASE_TYPE_H
 #define RAMULATOR_BASE_TYPE_H
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "ramulator/base/addr_vec.h"
+
 namespace Ramulator {
 
 using Clk_t = int64_t;               // Clock cycle
 using Addr_t = int64_t;              // Plain address as seen by the OS
-using AddrVec_t = std::vector<int>;  // Device address vector as is sent to the device from the controller
+using AddrVec_t = AddrVec;           // Device address vector as is sent to the device from the controller
+
+// Sentinel for "no event scheduled" in next-event queries
+inline constexpr Clk_t CLK_NEVER = std::numeric_limits<Clk_t>::max();
 
 template <typename T>
 using Registry_t = std::unordered_map<std::string, T>;
@@ -0,0 +1,119 @@
+#ifndef RAMULATOR_BASE_WORKER_POOL_H
+#define RAMULATOR_BASE_WORKER_POOL_H
+
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "ramulator/base/function_ref.h"
+
+namespace Ramulator {
+
+/**
+ * @brief     Persistent pool of threads for short, lock-step parallel sections
+ *
+ * run(num_tasks, fn) calls fn(i) for every i in [0, num_tasks) and returns once all
+ * calls have finished. Task i always runs on thread (i % num_threads), with thread 0
+ * being the caller, so per-task state stays on the same core across calls.
+ *
+ * Sections are expected to be short and frequent (e.g., once per simulated cycle):
+ * workers spin for a while before falling back to blocking on an atomic wait.
+ */
+class WorkerPool {
+ public:
+  explicit WorkerPool(int num_threads) : m_num_threads(num_threads), m_errors(num_threads) {
+    for (int tid = 1; tid < m_num_threads; tid++) {
+      m_workers.emplace_back([this, tid] { worker_loop(tid); });
+    }
+  }
+
+  ~WorkerPool() {
+    m_stop.store(true, std::memory_order_relaxed);
+    m_generation.fetch_add(1, std::memory_order_release);
+    m_generation.notify_all();
+    for (auto& worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  int num_threads() const {
+    return m_num_threads;
+  }
+
+  void run(int num_tasks, FunctionRef<void(int)> fn) {
+    m_fn = fn;
+    m_num_tasks = num_tasks;
+    m_num_done.store(0, std::memory_order_relaxed);
+    m_generation.fetch_add(1, std::memory_order_release);
+    m_generation.notify_all();
+
+    run_share(0);
+
+    while (m_num_done.load(std::memory_order_acquire) != m_num_threads - 1) {
+      std::this_thread::yield();
+    }
+
+    // Rethrow the first failure (lowest thread id) on the calling thread.
+    for (auto& error : m_errors) {
+      if (error) {
+        std::exception_ptr e = error;
+        for (auto& err : m_errors) {
+          err = nullptr;
+        }
+        std::rethrow_exception(e);
+      }
+    }
+  }
+
+ private:
+  static constexpr int kSpinIterations = 1 << 14;
+
+  int m_num_threads;
+  std::vector<std::thread> m_workers;
+  std::vector<std::exception_ptr> m_errors;
+
+  FunctionRef<void(int)> m_fn;
+  int m_num_tasks = 0;
+
+  std::atomic<unsigned> m_generation{0};
+  std::atomic<int> m_num_done{0};
+  std::atomic<bool> m_stop{false};
+
+  void run_share(int tid) {
+    try {
+      for (int i = tid; i < m_num_tasks; i += m_num_threads) {
+        m_fn(i);
+      }
+    } catch (...) {
+      m_errors[tid] = std::current_exception();
+    }
+  }
+
+  void worker_loop(int tid) {
+    unsigned seen = 0;
+    while (true) {
+      unsigned gen = m_generation.load(std::memory_order_acquire);
+      for (int spin = 0; gen == seen && spin < kSpinIterations; spin++) {
+        gen = m_generation.load(std::memory_order_acquire);
+      }
+      if (gen == seen) {
+        m_generation.wait(seen, std::memory_order_acquire);
+        continue;
+      }
+      seen = gen;
+      if (m_stop.load(std::memory_order_relaxed)) {
+        return;
+      }
+      run_share(tid);
+      m_num_done.fetch_add(1, std::memory_order_release);
+    }
+  }
+};
+
+}  // namespace Ramulator
+
+#endif  // RAMULATOR_BASE_WORKER_POOL_H
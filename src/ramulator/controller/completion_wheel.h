@@ -0,0 +1,154 @@
+#ifndef RAMULATOR_CONTROLLER_COMPLETION_WHEEL_H
+#define RAMULATOR_CONTROLLER_COMPLETION_WHEEL_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "ramulator/base/request.h"
+#include "ramulator/base/type.h"
+
+namespace Ramulator {
+
+/**
+ * @brief     Timing wheel of requests waiting for their depart cycle
+ *
+ * Requests are stored once in a slab of reusable slots; each wheel bucket
+ * (depart % num_buckets) chains slot handles in scheduling order. Departures
+ * may be scheduled in any order (forwarded reads, variable read latencies),
+ * and draining a cycle only touches that cycle's bucket. The wheel doubles
+ * whenever a departure lies beyond its horizon, so it ends up spanning the
+ * longest latency in use.
+ */
+class CompletionWheel {
+ public:
+  CompletionWheel() {
+    m_buckets.assign(kInitialBuckets, Bucket{});
+  }
+
+  bool empty() const {
+    return m_size == 0;
+  }
+  size_t size() const {
+    return m_size;
+  }
+
+  // Queue req for completion at req.depart (or the next drained cycle if that has passed).
+  void schedule(const Request& req) {
+    Clk_t depart = std::max(req.depart, m_cursor + 1);
+    while (depart - m_cursor >= static_cast<Clk_t>(m_buckets.size())) {
+      grow();
+    }
+    int idx = acquire_slot();
+    m_slots[idx].req = req;
+    link(idx, depart);
+    m_size++;
+  }
+
+  // Complete every request departing at or before clk, in depart order (scheduling order
+  // within a cycle). fn(Request&) gets a copy, so it may schedule more requests.
+  template <class F>
+  void drain_until(Clk_t clk, F&& fn) {
+    while (m_cursor < clk) {
+      if (m_size == 0) {
+        m_cursor = clk;
+        return;
+      }
+      m_cursor++;
+      for (;;) {
+        // Re-fetched every time: fn may schedule and grow the wheel
+        Bucket& bucket = m_buckets[bucket_of(m_cursor)];
+        if (bucket.head == kNil) {
+          break;
+        }
+        int idx = bucket.head;
+        bucket.head = m_slots[idx].next;
+        if (bucket.head == kNil) {
+          bucket.tail = kNil;
+        }
+        Request req = m_slots[idx].req;
+        release_slot(idx);
+        m_size--;
+        fn(req);
+      }
+    }
+  }
+
+  // Earliest pending depart cycle (CLK_NEVER if empty)
+  Clk_t next_depart() const {
+    if (m_size == 0) {
+      return CLK_NEVER;
+    }
+    for (Clk_t clk = m_cursor + 1;; clk++) {
+      if (m_buckets[bucket_of(clk)].head != kNil) {
+        return clk;
+      }
+    }
+  }
+
+ private:
+  static constexpr int kNil = -1;
+  static constexpr size_t kInitialBuckets = 64;
+
+  struct Slot {
+    Request req;
+    Clk_t depart = -1;
+    int next = kNil;
+  };
+  struct Bucket {
+    int head = kNil;
+    int tail = kNil;
+  };
+
+  std::vector<Slot> m_slots;
+  std::vector<Bucket> m_buckets;  // Power-of-two count; spans [m_cursor, m_cursor + size)
+  int m_free = kNil;              // Free slots, chained through Slot::next
+  size_t m_size = 0;
+  Clk_t m_cursor = 0;  // Every depart <= m_cursor has been drained
+
+  size_t bucket_of(Clk_t clk) const {
+    return static_cast<size_t>(clk) & (m_buckets.size() - 1);
+  }
+
+  int acquire_slot() {
+    if (m_free == kNil) {
+      m_slots.emplace_back();
+      return static_cast<int>(m_slots.size()) - 1;
+    }
+    int idx = m_free;
+    m_free = m_slots[idx].next;
+    return idx;
+  }
+
+  void release_slot(int idx) {
+    m_slots[idx].next = m_free;
+    m_free = idx;
+  }
+
+  void link(int idx, Clk_t depart) {
+    Slot& slot = m_slots[idx];
+    slot.depart = depart;
+    slot.next = kNil;
+    Bucket& bucket = m_buckets[bucket_of(depart)];
+    (bucket.tail == kNil ? bucket.head : m_slots[bucket.tail].next) = idx;
+    bucket.tail = idx;
+  }
+
+  // Double the wheel, re-linking pending requests bucket by bucket so FIFO order within a
+  // cycle is kept (departs stay within one horizon, so a bucket holds a single cycle).
+  void grow() {
+    std::vector<Bucket> old = std::exchange(m_buckets, std::vector<Bucket>(2 * m_buckets.size()));
+    for (size_t i = 0; i < old.size(); i++) {
+      const Bucket& bucket = old[static_cast<size_t>(m_cursor + static_cast<Clk_t>(i)) & (old.size() - 1)];
+      for (int idx = bucket.head; idx != kNil;) {
+        int next = m_slots[idx].next;
+        link(idx, m_slots[idx].depart);
+        idx = next;
+      }
+    }
+  }
+};
+
+}  // namespace Ramulator
+
+#endif  // RAMULATOR_CONTROLLER_COMPLETION_WHEEL_H
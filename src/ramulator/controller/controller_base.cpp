@@ -28,6 +28,56 @@ int ControllerBase::get_preq_command(int command, const AddrVec_t& addr_vec) {
   return m_device.get_preq_command(command, addr_vec, m_clk);
 }
 
+int ControllerBase::get_preq_command(Request& req) {
+  return m_device.get_preq_command(req, m_clk);
+}
+
+const std::vector<uint64_t>& ControllerBase::check_timing_batch(ReqBuffer& buffer) {
+  TimingBatch& batch = m_timing_batch;
+  if (batch.buffer == &buffer && batch.version == buffer.version() && batch.clk == m_clk &&
+      batch.issue_epoch == m_device.m_issue_epoch) {
+    return batch.ready_mask;
+  }
+  batch.buffer = &buffer;
+  batch.version = buffer.version();
+  batch.clk = m_clk;
+  batch.issue_epoch = m_device.m_issue_epoch;
+
+  const int n = static_cast<int>(buffer.size());
+  const bool batched = m_device.supports_timing_batch() && buffer.is_bank_indexed();
+  batch.commands.resize(n);
+  batch.banks.resize(n);
+  batch.ready_mask.assign((n + 63) / 64, 0);
+
+  // Single-bank commands on fully addressed requests go through the device's batched check;
+  // the rest (wildcards, multi-bank commands) get a placeholder and the regular walk below.
+  int num_walked = 0;
+  int i = 0;
+  for (auto it = buffer.begin(); it != buffer.end(); it++, i++) {
+    bool single = batched && it.bank() >= 0 && m_device.m_spec->bank_targets[it->command] == BankTarget::Single;
+    batch.commands[i] = single ? it->command : 0;
+    batch.banks[i] = single ? it.bank() : 0;
+    num_walked += single ? 0 : 1;
+  }
+  if (batched) {
+    m_device.check_timing_batch(batch.commands.data(), batch.banks.data(), n, m_clk, batch.ready_mask.data());
+  }
+  if (num_walked > 0) {
+    i = 0;
+    for (auto it = buffer.begin(); it != buffer.end(); it++, i++) {
+      if (batched && it.bank() >= 0 && m_device.m_spec->bank_targets[it->command] == BankTarget::Single) {
+        continue;
+      }
+      uint64_t bit = uint64_t(1) << (i % 64);
+      batch.ready_mask[i / 64] &= ~bit;
+      if (check_timing(it->command, it->addr_vec)) {
+        batch.ready_mask[i / 64] |= bit;
+      }
+    }
+  }
+  return batch.ready_mask;
+}
+
 int ControllerBase::get_tx_bytes() const {
   return m_device.m_spec->get_tx_bytes();
 }
@@ -49,6 +99,8 @@ void ControllerBase::init_base() {
   RAMULATOR_PARSE_PARAM(m_write_buffer_size, int, "write_buffer_size").default_val(32);
   // 1568 = 49 banks (4 BG × 4 banks × ~3 ranks) × 32 entries — large enough for all-bank refresh
   RAMULATOR_PARSE_PARAM(m_priority_buffer_size, int, "priority_buffer_size").default_val(1568);
+  // Allocate per-bank timing state on first use (large, mostly idle organizations)
+  RAMULATOR_PARSE_PARAM(m_lazy_bank_state, bool, "lazy_bank_state").default_val(false);
 
   m_read_buffer.max_size = m_read_buffer_size;
   m_write_buffer.max_size = m_write_buffer_size;
@@ -57,16 +109,38 @@ void ControllerBase::init_base() {
   // Create DRAMSpec and initialize the device
   // RAMULATOR_CHILD: dram
   std::string dram_impl = m_config["dram"]["impl"].as<std::string>();
-  m_device.init(DRAMSpec::create(dram_impl, m_config));
+  m_device.init(DRAMSpec::get_shared(dram_impl, m_config), m_lazy_bank_state);
 
   // Cache frequently-used lookups
   m_bank_level = m_device.m_spec->get_level_id("Bank");
+  if (m_device.m_spec->has_level("Subarray")) {
+    m_subarray_level = m_device.m_spec->get_level_id("Subarray");
+  }
   m_tCK_ps = m_device.m_spec->get_timing_value("tCK_ps");
+  if (m_device.m_spec->supported_requests.size() > Request::Type::Init) {
+    m_supports_copy = true;
+    m_rcsrc_cmd = m_device.m_spec->get_command_id("RCSRC");
+    m_rcdst_cmd = m_device.m_spec->get_command_id("RCDST");
+    m_fpm_latency = m_device.m_spec->get_timing_value("nFPM");
+    m_psm_latency = m_device.m_spec->get_timing_value("nPSM");
+    int num_lines = m_device.m_spec->organization.level_sizes.back() / m_device.m_spec->internal_prefetch_size;
+    m_row_bytes = num_lines * m_device.m_spec->get_tx_bytes();
+  }
 
   // Active buffer holds requests with in-flight opening commands (ACT).
-  // One request per bank at most, so size to total bank count.
+  // One request per bank (per subarray with SALP) at most, so size to that count.
   m_active_buffer.max_size = m_device.m_bank_nodes.size();
-  m_active_per_bank.assign(m_device.m_bank_nodes.size(), 0);
+  if (m_subarray_level >= 0) {
+    m_active_buffer.max_size *= m_device.m_spec->organization.level_sizes[m_subarray_level];
+  }
+
+  // Chain read/write/active requests per flat bank, so per-bank queries (would_close_active,
+  // row-hit detection) skip unrelated requests.
+  const auto& level_sizes = m_device.m_spec->organization.level_sizes;
+  std::vector<int> bank_radix(level_sizes.begin() + 1, level_sizes.begin() + m_bank_level + 1);
+  m_read_buffer.index_by_bank(bank_radix);
+  m_write_buffer.index_by_bank(bank_radix);
+  m_active_buffer.index_by_bank(bank_radix);
 
   // Create sub-components (must be specified in config — no defaults)
   RAMULATOR_CREATE_CHILD(m_scheduler, IScheduler);
@@ -127,6 +201,15 @@ void ControllerBase::setup_base(IFrontEnd* frontend, IMemorySystem* memory_syste
   m_stats.add("read_throughput_MBps", s_read_throughput_MBps);
   m_stats.add("write_throughput_MBps", s_write_throughput_MBps);
   m_stats.add("total_throughput_MBps", s_total_throughput_MBps);
+
+  if (m_supports_copy) {
+    m_stats.add("num_copy_reqs", s_num_copy_reqs);
+    m_stats.add("num_copy_reqs_served", s_num_copy_reqs_served);
+    m_stats.add("num_inter_bank_copies", s_num_inter_bank_copies);
+    m_stats.add("copy_latency", s_copy_latency);
+    m_stats.add("avg_copy_latency", s_avg_copy_latency);
+    m_stats.add("copy_throughput_MBps", s_copy_throughput_MBps);
+  }
 }
 
 // ── IController overrides ───────────────────────────────────────────────
@@ -137,7 +220,13 @@ bool ControllerBase::send(Request& req) {
   m_addr_mapper->apply(req);
   req.addr_vec[0] = m_channel_id;
 
-  req.final_command = m_device.m_spec->supported_requests[req.type_id];
+  const auto& supported_requests = m_device.m_spec->supported_requests;
+  if (req.type_id < 0 || req.type_id >= static_cast<int>(supported_requests.size())) {
+    throw std::runtime_error(fmt::format("{} does not support request type_id {}", m_device.m_spec->standard_name,
+                                         req.type_id));
+  }
+  req.final_command = supported_requests[req.type_id];
+  req.preq_cache = {};  // Senders may reuse a request object for other addresses
 
   // Forward existing write requests to incoming read requests
   if (req.type_id == Request::Type::Read) {
@@ -145,7 +234,7 @@ bool ControllerBase::send(Request& req) {
       // The request will depart at the next cycle
       req.arrive = m_clk;
       req.depart = m_clk + 1;
-      m_pending.push_back(req);
+      m_completions.schedule(req);
       s_num_read_reqs++;
       s_num_read_reqs_forwarded++;
       return true;
@@ -171,8 +260,7 @@ bool ControllerBase::send(Request& req) {
     is_success = m_write_buffer.enqueue(req);
     if (is_success) m_buffered_write_addrs.insert(req.addr);
   } else {
-    throw std::runtime_error(fmt::format(
-        "ControllerBase only supports Read (0) and Write (1) request types, got type_id {}", req.type_id));
+    is_success = enqueue_copy(req);
   }
   if (!is_success) {
     req.arrive = -1;
@@ -183,11 +271,65 @@ bool ControllerBase::send(Request& req) {
     s_num_read_reqs++;
   } else if (req.type_id == Request::Type::Write) {
     s_num_write_reqs++;
+  } else {
+    s_num_copy_reqs++;
+  }
+
+  return true;
+}
+
+bool ControllerBase::enqueue_copy(Request& req) {
+  // Copies write their destination, so they drain with the writes (but never forward or coalesce)
+  if (req.type_id == Request::Type::Init) {
+    return m_write_buffer.enqueue(req);
+  }
+  if (req.src_intra_channel_addr < 0) {
+    throw std::runtime_error("Copy request without a source address");
+  }
+  Request src = req;
+  src.intra_channel_addr = req.src_intra_channel_addr;
+  m_addr_mapper->apply(src);
+  src.addr_vec[0] = m_channel_id;
+  if (m_device.get_flat_bank_id(src.addr_vec) == m_device.get_flat_bank_id(req.addr_vec)) {
+    // Same bank: FPM, with the source assumed in the destination's subarray (RowClone's allocator)
+    return m_write_buffer.enqueue(req);
   }
 
+  // Across banks: the source side streams the row out while the destination side writes it
+  if (m_write_buffer.size() + 2 > m_write_buffer.max_size) {
+    return false;
+  }
+  // The destination side is held back until the source side has read the row (see pick_rw_if())
+  req.final_command = m_rcdst_cmd;
+  m_write_buffer.enqueue(req);
+  Request src_side(src.addr_vec, Request::Cmd, m_rcsrc_cmd);
+  src_side.arrive = m_clk;
+  src_side.intra_channel_addr = req.intra_channel_addr;  // The copy it belongs to
+  src_side.src_intra_channel_addr = req.src_intra_channel_addr;
+  m_write_buffer.enqueue(src_side);
+  s_num_maintenance_reqs++;
+  s_num_inter_bank_copies++;
   return true;
 }
 
+bool ControllerBase::is_waiting_for_copy_source(const Request& req) const {
+  if (req.final_command != m_rcdst_cmd) {
+    return false;
+  }
+  auto it = m_psm_sources_read.find({req.src_intra_channel_addr, req.intra_channel_addr});
+  return it == m_psm_sources_read.end() || it->second <= 0;
+}
+
+void ControllerBase::count_psm_source_read(const Request& req, int delta) {
+  // Identical copies share a count, so a destination side may consume a read issued for its twin
+  auto key = std::make_pair(req.src_intra_channel_addr, req.intra_channel_addr);
+  int& count = m_psm_sources_read[key];
+  count += delta;
+  if (count == 0) {
+    m_psm_sources_read.erase(key);
+  }
+}
+
 bool ControllerBase::priority_send(Request& req) {
   if (req.final_command < 0 || req.final_command >= m_device.m_spec->command_count) {
     throw std::runtime_error(fmt::format(
@@ -196,6 +338,7 @@ bool ControllerBase::priority_send(Request& req) {
         m_device.m_spec->command_count));
   }
 
+  req.preq_cache = {};
   bool is_success = m_priority_buffer.enqueue(req);
   if (is_success && req.type_id == -1) {
     s_num_maintenance_reqs++;
@@ -203,6 +346,82 @@ bool ControllerBase::priority_send(Request& req) {
   return is_success;
 }
 
+// ── Idle fast-forward ───────────────────────────────────────────────────
+
+Clk_t ControllerBase::get_next_event_clk() {
+  // Nothing can issue before some buffered request passes timing, and nothing else happens
+  // on an idle tick except read completions and the sub-components' own events.
+  Clk_t next = m_refresh->get_next_event_clk(m_clk);
+  next = std::min(next, m_rowpolicy->get_next_event_clk(m_clk));
+  for (auto* p : m_plugins) {
+    next = std::min(next, p->get_next_event_clk(m_clk));
+  }
+  next = std::min(next, m_completions.next_depart());
+  // Only the head of the priority buffer is ever considered for issue.
+  if (m_priority_buffer.size() > 0) {
+    auto it = m_priority_buffer.begin();
+    int cmd = get_preq_command(*it);
+    next = std::min(next, m_device.get_ready_clk(cmd, it->addr_vec));
+  }
+  for (ReqBuffer* buffer : {&m_active_buffer, &m_read_buffer, &m_write_buffer}) {
+    if (next <= m_clk + 1) {
+      break;
+    }
+    next = std::min(next, get_earliest_ready_clk(*buffer));
+  }
+  return std::max(next, m_clk + 1);
+}
+
+Clk_t ControllerBase::get_earliest_ready_clk(ReqBuffer& buffer) {
+  Clk_t earliest = CLK_NEVER;
+  for (auto it = buffer.begin(); it != buffer.end(); it++) {
+    int cmd = get_preq_command(*it);
+    earliest = std::min(earliest, m_device.get_ready_clk(cmd, it->addr_vec));
+    // Anything at or before the next tick cannot be skipped anyway.
+    if (earliest <= m_clk + 1) {
+      break;
+    }
+  }
+  return earliest;
+}
+
+void ControllerBase::fast_forward(Clk_t num_ticks) {
+  m_clk += num_ticks;
+  m_measured_clk += num_ticks;
+
+  s_queue_len += (m_read_buffer.size() + m_write_buffer.size() + m_priority_buffer.size()) * num_ticks;
+  s_read_queue_len += m_read_buffer.size() * num_ticks;
+  s_write_queue_len += m_write_buffer.size() * num_ticks;
+  s_priority_queue_len += m_priority_buffer.size() * num_ticks;
+
+  // Idle ticks still reach pick_rw_if() whenever the priority buffer is empty, which
+  // settles the write-mode hysteresis. The buffer sizes are constant meanwhile, so one
+  // update is equivalent to num_ticks of them.
+  if (num_ticks > 0 && m_priority_buffer.size() == 0) {
+    set_write_mode();
+  }
+}
+
+// ── Parallel ticking ────────────────────────────────────────────────────
+
+void ControllerBase::run_deferred_callbacks() {
+  for (auto& req : m_deferred_callbacks) {
+    req.callback(req);
+  }
+  m_deferred_callbacks.clear();
+}
+
+void ControllerBase::complete_request(Request& req) {
+  if (!req.callback) {
+    return;
+  }
+  if (m_defer_callbacks) {
+    m_deferred_callbacks.push_back(req);
+  } else {
+    req.callback(req);
+  }
+}
+
 // ── Tick preamble ───────────────────────────────────────────────────────
 
 void ControllerBase::tick_prologue() {
@@ -220,28 +439,34 @@ void ControllerBase::tick_prologue() {
 // ── Request lifecycle ────────────────────────────────────────────────────
 
 void ControllerBase::retire_request(ReqBuffer::iterator& req_it, ReqBuffer& buffer) {
-  if (&buffer == &m_active_buffer) {
-    m_active_per_bank[m_device.get_flat_bank_id(req_it->addr_vec)]--;
-  }
-  if (&buffer == &m_write_buffer) {
+  if (&buffer == &m_write_buffer && req_it->type_id == Request::Type::Write) {
     m_buffered_write_addrs.erase(req_it->addr);
   }
 
   if (req_it->type_id == Request::Type::Read) {
     // Read: completion with read latency
     req_it->depart = m_clk + m_device.m_spec->read_latency;
-    m_pending.push_back(*req_it);
+    m_completions.schedule(*req_it);
     s_num_read_reqs_served++;
   } else if (req_it->type_id == Request::Type::Write) {
     // Write: For now we call the callback here.
     // TODO: We could also do it after a write_latency (e.g., nCWL+nBL)
     // similarily as reads
-    if (req_it->callback) {
-      req_it->callback(*req_it);
-    }
+    complete_request(*req_it);
     s_num_write_reqs_served++;
   } else if (req_it->type_id == -1) {
+    if (req_it->final_command == m_rcsrc_cmd && m_supports_copy) {
+      // Source row read: release the destination side of its copy
+      count_psm_source_read(*req_it, +1);
+    }
     s_num_maintenance_reqs_served++;
+  } else {
+    // Copy/Init: completes once the in-DRAM copy is done
+    if (req_it->final_command == m_rcdst_cmd) {
+      count_psm_source_read(*req_it, -1);
+    }
+    req_it->depart = m_clk + (req_it->final_command == m_rcdst_cmd ? m_psm_latency : m_fpm_latency);
+    m_completions.schedule(*req_it);
   }
   // Maintenance/direct-command requests are removed once their terminal command issues.
   buffer.remove(req_it);
@@ -249,8 +474,7 @@ void ControllerBase::retire_request(ReqBuffer::iterator& req_it, ReqBuffer& buff
 
 void ControllerBase::promote_to_active(ReqBuffer::iterator& req_it, ReqBuffer& buffer) {
   if (m_active_buffer.enqueue(*req_it)) {
-    m_active_per_bank[m_device.get_flat_bank_id(req_it->addr_vec)]++;
-    if (&buffer == &m_write_buffer) {
+    if (&buffer == &m_write_buffer && req_it->type_id == Request::Type::Write) {
       m_buffered_write_addrs.erase(req_it->addr);
     }
     buffer.remove(req_it);
@@ -285,7 +509,7 @@ ControllerBase::Candidate ControllerBase::pick_priority_if(RequestFilterRef filt
   }
 
   auto it = m_priority_buffer.begin();
-  it->command = get_preq_command(it->final_command, it->addr_vec);
+  it->command = get_preq_command(*it);
   if (!check_timing(it->command, it->addr_vec)) {
     return c;
   }
@@ -309,6 +533,11 @@ ControllerBase::Candidate ControllerBase::pick_rw_if(RequestFilterRef filter) {
     if (would_close_active(req)) {
       return false;
     }
+    // Copying across banks: no command of the destination side (not even its ACT, which
+    // could hold a bank the source side needs) goes ahead of the source read
+    if (m_supports_copy && is_waiting_for_copy_source(req)) {
+      return false;
+    }
     return !filter || filter(req);
   });
 }
@@ -325,20 +554,26 @@ bool ControllerBase::would_close_active(const Request& req) const {
 
   // Hot path: single-bank close (PREpb, RDA, WRA) — O(1) lookup.
   if (target == BankTarget::Single) {
-    return m_active_per_bank[m_device.get_flat_bank_id(req.addr_vec)] > 0;
-  }
-
-  // All / SameBank: scan occupied banks with proper scope checking.
-  // These are rare maintenance commands — linear scan skipping zeros is fine.
-  for (int i = 0; i < static_cast<int>(m_active_per_bank.size()); i++) {
-    if (m_active_per_bank[i] == 0) {
-      continue;
+    int flat_bank_id = m_device.get_flat_bank_id(req.addr_vec);
+    if (m_active_buffer.bank_size(flat_bank_id) == 0 || m_subarray_level < 0) {
+      return m_active_buffer.bank_size(flat_bank_id) > 0;
     }
-    if (target == BankTarget::SameBank &&
-        m_device.m_bank_nodes[i]->m_node_id != req.addr_vec[m_bank_level]) {
-      continue;
+    // Subarrays: only a precharge of the active request's own subarray closes its row
+    int subarray = req.addr_vec[m_subarray_level];
+    for (const Request& active : m_active_buffer.bank_requests(flat_bank_id)) {
+      if (subarray < 0 || active.addr_vec[m_subarray_level] == subarray) {
+        return true;
+      }
     }
-    if (m_device.bank_matches(m_device.m_bank_nodes[i], req.addr_vec)) {
+    return false;
+  }
+
+  // All / SameBank: check the occupied banks against the command's scope.
+  if (target == BankTarget::SameBank && req.addr_vec[m_bank_level] < 0) {
+    return false;
+  }
+  for (int i : m_active_buffer.busy_banks()) {
+    if (m_device.bank_in_scope(i, req.addr_vec)) {
       return true;
     }
   }
@@ -383,21 +618,16 @@ void ControllerBase::update_request_stats(ReqBuffer::iterator& req) {
 }
 
 void ControllerBase::serve_completed_reads() {
-  // Drain all pending requests whose depart time has been reached.
-  // The deque is sorted by depart time (m_clk is monotonic, send() runs
-  // before tick(), and read_latency > 1), so we can stop at the first
-  // request that isn't ready yet.
-  while (m_pending.size()) {
-    auto& req = m_pending.front();
-    if (req.depart > m_clk) {
-      break;
-    }
-    s_read_latency += req.depart - req.arrive;
-    if (req.callback) {
-      req.callback(req);
+  // Complete every request whose depart time has been reached, in depart order.
+  m_completions.drain_until(m_clk, [this](Request& req) {
+    if (req.type_id == Request::Type::Read) {
+      s_read_latency += req.depart - req.arrive;
+    } else {
+      s_copy_latency += req.depart - req.arrive;
+      s_num_copy_reqs_served++;
     }
-    m_pending.pop_front();
-  }
+    complete_request(req);
+  });
 }
 
 void ControllerBase::set_write_mode() {
@@ -425,6 +655,9 @@ void ControllerBase::update_stats() {
   s_read_throughput_MBps = (time_ps > 0) ? s_num_read_reqs_served * tx_bytes * 1e6f / time_ps : 0;
   s_write_throughput_MBps = (time_ps > 0) ? s_num_write_reqs_served * tx_bytes * 1e6f / time_ps : 0;
   s_total_throughput_MBps = s_read_throughput_MBps + s_write_throughput_MBps;
+
+  s_avg_copy_latency = (s_num_copy_reqs_served > 0) ? (float)s_copy_latency / (float)s_num_copy_reqs_served : 0;
+  s_copy_throughput_MBps = (time_ps > 0) ? s_num_copy_reqs_served * m_row_bytes * 1e6f / time_ps : 0;
 }
 
 void ControllerBase::finalize() {
@@ -468,6 +701,12 @@ void ControllerBase::reset_stats() {
 
   s_read_latency = 0;
   s_avg_read_latency = 0;
+  s_num_copy_reqs = 0;
+  s_num_copy_reqs_served = 0;
+  s_num_inter_bank_copies = 0;
+  s_copy_latency = 0;
+  s_avg_copy_latency = 0;
+  s_copy_throughput_MBps = 0;
   s_read_throughput_MBps = 0;
   s_write_throughput_MBps = 0;
   s_total_throughput_MBps = 0;
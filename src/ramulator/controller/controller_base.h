@@ -1,12 +1,15 @@
 #ifndef RAMULATOR_CONTROLLER_CONTROLLER_BASE_H
 #define RAMULATOR_CONTROLLER_CONTROLLER_BASE_H
 
-#include <deque>
+#include <cstdint>
+#include <map>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "ramulator/controller/addr_mapper/i_addr_mapper.h"
+#include "ramulator/controller/completion_wheel.h"
 #include "ramulator/controller/i_controller.h"
 #include "ramulator/controller/plugin/i_controller_plugin.h"
 #include "ramulator/controller/scheduler/i_scheduler.h"
@@ -30,6 +33,12 @@ class ControllerBase : public IController, public Implementation {
   // Forwarding methods — bind m_clk for sub-components
   bool check_timing(int command, const AddrVec_t& addr_vec);
   int get_preq_command(int command, const AddrVec_t& addr_vec);
+  int get_preq_command(Request& req);  // Memoized prerequisite of req.final_command
+
+  // check_timing() of every request in buffer at once (req.command must already be derived).
+  // Bit i is set iff the i-th request in iteration order is timing-ready. Valid until the next
+  // call; reused while the buffer, clock and device are unchanged (e.g., HBM's second slot).
+  const std::vector<uint64_t>& check_timing_batch(ReqBuffer& buffer);
 
   // IController overrides
   void set_channel_id(int channel_id) override;
@@ -40,6 +49,17 @@ class ControllerBase : public IController, public Implementation {
   bool send(Request& req) override;
   bool priority_send(Request& req) override;
 
+  Clk_t get_next_event_clk() override;
+  void fast_forward(Clk_t num_ticks) override;
+
+  bool supports_parallel_tick() const override {
+    return true;
+  }
+  void set_defer_callbacks(bool defer) override {
+    m_defer_callbacks = defer;
+  }
+  void run_deferred_callbacks() override;
+
   void update_stats() override;
   void finalize() override;
   void reset_stats() override;
@@ -62,29 +82,54 @@ class ControllerBase : public IController, public Implementation {
   std::vector<IControllerPlugin*> m_plugins;
 
   // Request buffers
-  std::deque<Request> m_pending;
-  ReqBuffer m_active_buffer;
+  CompletionWheel m_completions;  // Reads (incl. forwarded ones) waiting for their depart cycle
+  ReqBuffer m_active_buffer;    // Bank-indexed; typically 0 or 1 request per bank
   ReqBuffer m_priority_buffer;
-  ReqBuffer m_read_buffer;
-  ReqBuffer m_write_buffer;
+  ReqBuffer m_read_buffer;      // Bank-indexed
+  ReqBuffer m_write_buffer;     // Bank-indexed
   // Efficiently tracks addresses of buffered write requests for write-forwarding
   std::unordered_set<Addr_t> m_buffered_write_addrs;
 
+  // Completions raised in tick() while callbacks are deferred (parallel ticking)
+  bool m_defer_callbacks = false;
+  std::vector<Request> m_deferred_callbacks;
+
+  // Scratch and memo of check_timing_batch()
+  struct TimingBatch {
+    const ReqBuffer* buffer = nullptr;
+    uint64_t version = 0;
+    uint64_t issue_epoch = 0;
+    Clk_t clk = -1;
+    std::vector<int> commands;
+    std::vector<int> banks;
+    std::vector<uint64_t> ready_mask;
+  };
+  TimingBatch m_timing_batch;
+
   // Buffer config
   int m_read_buffer_size;
   int m_write_buffer_size;
   int m_priority_buffer_size;
+  bool m_lazy_bank_state;
   float m_wr_low_watermark;
   float m_wr_high_watermark;
   bool m_is_write_mode = false;
 
   // Cached spec lookups
   int m_bank_level = -1;
+  int m_subarray_level = -1;  // -1 unless the standard splits banks into subarrays (SALP)
   int m_tCK_ps = -1;
 
-  // Per flat-bank count of requests in m_active_buffer (typically 0 or 1).
-  // Maintained by promote_to_active / retire_request.
-  std::vector<int> m_active_per_bank;
+  // RowClone (standards that accept Copy/Init requests)
+  bool m_supports_copy = false;
+  int m_rcsrc_cmd = -1;    // Source and destination sides of an inter-bank (PSM) copy
+  int m_rcdst_cmd = -1;
+  int m_fpm_latency = 0;   // Cycles from the final command of a copy to its completion
+  int m_psm_latency = 0;
+  int m_row_bytes = 0;     // Bytes copied per request (one row across the rank)
+  // Inter-bank copies whose source row has been read (RCSRC issued) but not yet written,
+  // keyed by (source, destination) intra-channel address. The destination side waits for one.
+  std::map<std::pair<Addr_t, Addr_t>, int> m_psm_sources_read;
 
   // Stats
   Clk_t m_measured_clk = 0;
@@ -124,6 +169,13 @@ class ControllerBase : public IController, public Implementation {
   size_t s_read_latency = 0;
   float s_avg_read_latency = 0;
 
+  size_t s_num_copy_reqs = 0;  // Copy and Init
+  size_t s_num_copy_reqs_served = 0;
+  size_t s_num_inter_bank_copies = 0;
+  size_t s_copy_latency = 0;
+  float s_avg_copy_latency = 0;
+  float s_copy_throughput_MBps = 0;
+
   float s_read_throughput_MBps = 0;
   float s_write_throughput_MBps = 0;
   float s_total_throughput_MBps = 0;
@@ -132,9 +184,18 @@ class ControllerBase : public IController, public Implementation {
   // drain completed reads.
   void tick_prologue();
 
-  // Final command done — move to pending (reads) or remove (writes/maintenance).
+  // Invoke (or queue, if deferred) the request's completion callback.
+  void complete_request(Request& req);
+
+  // Final command done — move to pending (reads/copies) or remove (writes/maintenance).
   void retire_request(ReqBuffer::iterator& req_it, ReqBuffer& buffer);
 
+  // Buffer a Copy/Init request: FPM within a bank, RCSRC + RCDST across banks
+  bool enqueue_copy(Request& req);
+  // The destination side of an inter-bank copy whose source row has not been read yet
+  bool is_waiting_for_copy_source(const Request& req) const;
+  void count_psm_source_read(const Request& req, int delta);
+
   // Opening command done — move request from source buffer to active buffer.
   void promote_to_active(ReqBuffer::iterator& req_it, ReqBuffer& buffer);
 
@@ -152,6 +213,9 @@ class ControllerBase : public IController, public Implementation {
   Candidate pick_priority_if(RequestFilterRef filter = {});
   Candidate pick_rw_if(RequestFilterRef filter = {});
 
+  // Earliest cycle any request in the buffer could pass timing for its next command
+  Clk_t get_earliest_ready_clk(ReqBuffer& buffer);
+
   // Scheduling helpers
   bool would_close_active(const Request& req) const;
   void update_request_stats(ReqBuffer::iterator& req);
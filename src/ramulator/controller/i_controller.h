@@ -1,7 +1,13 @@
 #ifndef RAMULATOR_CONTROLLER_I_CONTROLLER_H
 #define RAMULATOR_CONTROLLER_I_CONTROLLER_H
 
-#include <list>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 #include "ramulator/base/base.h"
 
@@ -26,48 +32,359 @@ class IController {
   virtual bool priority_send(Request& req) = 0;
   virtual void tick() = 0;
 
+  // Idle fast-forward. get_next_event_clk() returns the earliest cycle whose tick() may change
+  // state, assuming no new requests arrive; fast_forward() advances over that many idle ticks.
+  // The defaults never allow skipping.
+  virtual Clk_t get_next_event_clk() {
+    return m_clk + 1;
+  }
+  virtual void fast_forward(Clk_t num_ticks) {
+  }
+
+  // Parallel ticking. Controllers that report support touch no state outside their own channel
+  // in tick(), except through request callbacks; while deferral is on, those callbacks are queued
+  // and run_deferred_callbacks() replays them (in order) on the calling thread.
+  virtual bool supports_parallel_tick() const {
+    return false;
+  }
+  virtual void set_defer_callbacks(bool defer) {
+  }
+  virtual void run_deferred_callbacks() {
+  }
+
   virtual int get_tx_bytes() const = 0;
   virtual int get_num_levels() const = 0;
   virtual float get_tCK() const = 0;
 };
 
+/**
+ * @brief     Bounded FIFO of requests backed by a slab of reusable slots
+ *
+ * Slots are linked in insertion order and recycled through an intrusive free
+ * list, so steady-state enqueue/remove never allocates and scans walk one
+ * contiguous array. The slab grows geometrically up to max_size the first
+ * time it fills. Iterators are (buffer, slot) pairs: like std::list iterators
+ * they stay valid until their own element is removed.
+ *
+ * Optionally (index_by_bank()), requests are also chained per flat bank, so
+ * "requests for bank X" and "banks with requests" cost O(bank queue) and
+ * O(busy banks) instead of a scan of the whole buffer.
+ */
 struct ReqBuffer {
-  std::list<Request> buffer;
+ private:
+  static constexpr int kNil = -1;
+  static constexpr size_t kInitialSlots = 16;
+
+  struct Slot {
+    Request req;
+    int prev = kNil;
+    int next = kNil;
+    uint64_t stamp = 0;  // m_version at enqueue; tells apart successive occupants of a slot
+    int bank = kNil;     // Flat bank id when bank-indexed (kNil if unindexed or wildcard)
+    int bank_prev = kNil;
+    int bank_next = kNil;
+  };
+
+  struct BankQueue {
+    int head = kNil;
+    int tail = kNil;
+    int size = 0;
+    int busy_pos = kNil;  // Index into m_busy_banks while the queue is non-empty
+  };
+
+  std::vector<Slot> m_slots;
+  int m_head = kNil;
+  int m_tail = kNil;
+  int m_free = kNil;  // Free slots, chained through Slot::next
+  size_t m_size = 0;
+  uint64_t m_version = 0;  // Bumped on every enqueue and remove
+
+  std::vector<int> m_bank_radix;  // Level sizes from level 1 down to Bank; empty = not indexed
+  std::vector<BankQueue> m_bank_queues;
+  std::vector<int> m_busy_banks;  // Flat ids of banks with at least one request (unordered)
+
+ public:
   size_t max_size;
 
   explicit ReqBuffer(size_t max_size = 32) : max_size(max_size) {
   }
 
-  using iterator = std::list<Request>::iterator;
+  class iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Request;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Request*;
+    using reference = Request&;
+
+    iterator() = default;
+
+    Request& operator*() const {
+      return m_buffer->m_slots[m_idx].req;
+    }
+    Request* operator->() const {
+      return &m_buffer->m_slots[m_idx].req;
+    }
+    iterator& operator++() {
+      m_idx = m_buffer->m_slots[m_idx].next;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator prev = *this;
+      ++*this;
+      return prev;
+    }
+    iterator& operator--() {
+      m_idx = (m_idx == kNil) ? m_buffer->m_tail : m_buffer->m_slots[m_idx].prev;
+      return *this;
+    }
+    iterator operator--(int) {
+      iterator next = *this;
+      --*this;
+      return next;
+    }
+    // Slab index (stable while the element is buffered) and enqueue stamp (unique per element)
+    int slot() const {
+      return m_idx;
+    }
+    uint64_t stamp() const {
+      return m_buffer->m_slots[m_idx].stamp;
+    }
+    // Flat bank id of a bank-indexed element (-1 if unindexed or addressed with a wildcard)
+    int bank() const {
+      return m_buffer->m_slots[m_idx].bank;
+    }
+    friend bool operator==(const iterator& a, const iterator& b) {
+      return a.m_idx == b.m_idx && a.m_buffer == b.m_buffer;
+    }
+
+   private:
+    friend struct ReqBuffer;
+    iterator(ReqBuffer* buffer, int idx) : m_buffer(buffer), m_idx(idx) {
+    }
+    ReqBuffer* m_buffer = nullptr;
+    int m_idx = kNil;
+  };
+
+  // Walks the requests of one bank, in insertion order
+  template <bool Const>
+  class basic_bank_iterator {
+    using Buffer = std::conditional_t<Const, const ReqBuffer, ReqBuffer>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Request;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const Request*, Request*>;
+    using reference = std::conditional_t<Const, const Request&, Request&>;
+
+    basic_bank_iterator() = default;
+
+    reference operator*() const {
+      return m_buffer->m_slots[m_idx].req;
+    }
+    pointer operator->() const {
+      return &m_buffer->m_slots[m_idx].req;
+    }
+    basic_bank_iterator& operator++() {
+      m_idx = m_buffer->m_slots[m_idx].bank_next;
+      return *this;
+    }
+    basic_bank_iterator operator++(int) {
+      basic_bank_iterator prev = *this;
+      ++*this;
+      return prev;
+    }
+    // The same element as a whole-buffer iterator (e.g., to return it from a scheduler)
+    iterator base() const
+      requires(!Const)
+    {
+      return iterator(m_buffer, m_idx);
+    }
+    friend bool operator==(const basic_bank_iterator& a, const basic_bank_iterator& b) {
+      return a.m_idx == b.m_idx && a.m_buffer == b.m_buffer;
+    }
+
+   private:
+    friend struct ReqBuffer;
+    basic_bank_iterator(Buffer* buffer, int idx) : m_buffer(buffer), m_idx(idx) {
+    }
+    Buffer* m_buffer = nullptr;
+    int m_idx = kNil;
+  };
+  using bank_iterator = basic_bank_iterator<false>;
+  using const_bank_iterator = basic_bank_iterator<true>;
+
+  template <typename BankIterator>
+  struct BankRange {
+    BankIterator first;
+    BankIterator last;
+    BankIterator begin() const {
+      return first;
+    }
+    BankIterator end() const {
+      return last;
+    }
+  };
+
   iterator begin() {
-    return buffer.begin();
+    return iterator(this, m_head);
   }
   iterator end() {
-    return buffer.end();
+    return iterator(this, kNil);
   }
 
   size_t size() const {
-    return buffer.size();
+    return m_size;
+  }
+  size_t num_slots() const {
+    return m_slots.size();
+  }
+  uint64_t version() const {
+    return m_version;
   }
 
-  bool enqueue(const Request& request) {
-    if (buffer.size() < max_size) {
-      buffer.push_back(request);
-      return true;
+  // Chain requests per flat bank from now on. bank_radix holds the level sizes from level 1
+  // down to the Bank level (flat id as in DRAMDevice::get_flat_bank_id()). The buffer must be
+  // empty. Requests with a wildcard above Bank are kept but not indexed.
+  void index_by_bank(std::vector<int> bank_radix) {
+    if (m_size != 0) {
+      throw std::runtime_error("ReqBuffer: index_by_bank() requires an empty buffer");
     }
-    return false;
+    int num_banks = 1;
+    for (int n : bank_radix) {
+      num_banks *= n;
+    }
+    m_bank_radix = std::move(bank_radix);
+    m_bank_queues.assign(num_banks, BankQueue{});
+    m_busy_banks.clear();
+    m_busy_banks.reserve(num_banks);
+  }
+  bool is_bank_indexed() const {
+    return !m_bank_radix.empty();
+  }
+  const std::vector<int>& busy_banks() const {
+    return m_busy_banks;
+  }
+  int bank_size(int flat_bank_id) const {
+    return m_bank_queues[flat_bank_id].size;
+  }
+  BankRange<bank_iterator> bank_requests(int flat_bank_id) {
+    return {bank_iterator(this, m_bank_queues[flat_bank_id].head), bank_iterator(this, kNil)};
+  }
+  BankRange<const_bank_iterator> bank_requests(int flat_bank_id) const {
+    return {const_bank_iterator(this, m_bank_queues[flat_bank_id].head), const_bank_iterator(this, kNil)};
   }
 
-  bool enqueue(Request&& request) {
-    if (buffer.size() < max_size) {
-      buffer.push_back(std::move(request));
-      return true;
+  bool enqueue(const Request& request) {
+    if (m_size >= max_size) {
+      return false;
     }
-    return false;
+    if (m_free == kNil) {
+      // request may be an element of this buffer (e.g., an active request re-activating), and
+      // growing reallocates the slots: copy it out first
+      Request copy = request;
+      grow();
+      return enqueue(copy);
+    }
+    int idx = acquire_slot();
+    m_slots[idx].req = request;
+    link_bank(idx);
+    return true;
   }
 
   void remove(iterator it) {
-    buffer.erase(it);
+    int idx = it.m_idx;
+    unlink_bank(idx);
+    Slot& slot = m_slots[idx];
+    (slot.prev == kNil ? m_head : m_slots[slot.prev].next) = slot.next;
+    (slot.next == kNil ? m_tail : m_slots[slot.next].prev) = slot.prev;
+    slot.prev = kNil;
+    slot.next = m_free;
+    m_free = idx;
+    m_size--;
+    m_version++;
+  }
+
+ private:
+  // Take a free slot (growing the slab if needed) and link it at the tail.
+  int acquire_slot() {
+    if (m_free == kNil) {
+      grow();
+    }
+    int idx = m_free;
+    Slot& slot = m_slots[idx];
+    m_free = slot.next;
+    slot.prev = m_tail;
+    slot.next = kNil;
+    (m_tail == kNil ? m_head : m_slots[m_tail].next) = idx;
+    m_tail = idx;
+    m_size++;
+    slot.stamp = ++m_version;
+    return idx;
+  }
+
+  int bank_of(const Request& req) const {
+    int id = 0;
+    for (size_t i = 0; i < m_bank_radix.size(); i++) {
+      if (i + 1 >= req.addr_vec.size() || req.addr_vec[i + 1] < 0) {
+        return kNil;
+      }
+      id = id * m_bank_radix[i] + req.addr_vec[i + 1];
+    }
+    return id;
+  }
+
+  void link_bank(int idx) {
+    if (m_bank_radix.empty()) {
+      return;
+    }
+    Slot& slot = m_slots[idx];
+    slot.bank = bank_of(slot.req);
+    if (slot.bank == kNil) {
+      return;
+    }
+    BankQueue& q = m_bank_queues[slot.bank];
+    slot.bank_prev = q.tail;
+    slot.bank_next = kNil;
+    (q.tail == kNil ? q.head : m_slots[q.tail].bank_next) = idx;
+    q.tail = idx;
+    if (q.size++ == 0) {
+      q.busy_pos = static_cast<int>(m_busy_banks.size());
+      m_busy_banks.push_back(slot.bank);
+    }
+  }
+
+  void unlink_bank(int idx) {
+    Slot& slot = m_slots[idx];
+    if (slot.bank == kNil) {
+      return;
+    }
+    BankQueue& q = m_bank_queues[slot.bank];
+    (slot.bank_prev == kNil ? q.head : m_slots[slot.bank_prev].bank_next) = slot.bank_next;
+    (slot.bank_next == kNil ? q.tail : m_slots[slot.bank_next].bank_prev) = slot.bank_prev;
+    if (--q.size == 0) {
+      // Swap-remove from the busy list
+      int moved = m_busy_banks.back();
+      m_busy_banks[q.busy_pos] = moved;
+      m_bank_queues[moved].busy_pos = q.busy_pos;
+      m_busy_banks.pop_back();
+      q.busy_pos = kNil;
+    }
+    slot.bank = kNil;
+    slot.bank_prev = kNil;
+    slot.bank_next = kNil;
+  }
+
+  void grow() {
+    size_t old_cap = m_slots.size();
+    size_t new_cap = std::min(std::max(kInitialSlots, 2 * old_cap), max_size);
+    m_slots.resize(new_cap);
+    // Chain new slots in ascending order so fresh buffers fill the slab front to back
+    for (size_t i = new_cap; i-- > old_cap;) {
+      m_slots[i].next = m_free;
+      m_free = static_cast<int>(i);
+    }
   }
 };
 
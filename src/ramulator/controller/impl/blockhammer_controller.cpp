@@ -336,6 +336,16 @@ class BlockHammerController : public ControllerBase {
 
   void tick() override;
 
+  // Bloom filter epochs and history buffers advance on every tick; never fast-forward.
+  Clk_t get_next_event_clk() override {
+    return m_clk + 1;
+  }
+
+  // Updates the frontend's shared LLC blacklist from tick(), so channels must tick in order.
+  bool supports_parallel_tick() const override {
+    return false;
+  }
+
  private:
   // Params
   int m_bf_num_filters = -1;
@@ -92,6 +92,14 @@ class GDDR7Controller final : public HBMControllerBase {
     return HBMControllerBase::priority_send(req);
   }
 
+  Clk_t get_next_event_clk() override {
+    // RCKSTRT/RCKSTOP are injected from internal state (idle threshold), not from the buffers.
+    if (m_rck_mode != RCKMode::AlwaysOn) {
+      return m_clk + 1;
+    }
+    return HBMControllerBase::get_next_event_clk();
+  }
+
   void tick() override {
     hbm_tick_prologue();
     auto col = try_issue_internal_rck();
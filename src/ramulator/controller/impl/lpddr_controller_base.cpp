@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cassert>
 #include <fmt/format.h>
 #include <stdexcept>
@@ -111,6 +112,20 @@ void LPDDRControllerBase::tick() {
   }
 }
 
+Clk_t LPDDRControllerBase::get_next_event_clk() {
+  // A CAS continuation pins the next tick to the deferred RD/WR.
+  if (m_cas_issued) {
+    return m_clk + 1;
+  }
+
+  // Split activations waiting for ACT2 are issued (urgently or deferred) once ACT2 is ready.
+  Clk_t next = ControllerBase::get_next_event_clk();
+  for (auto it = m_activating_buffer.begin(); it != m_activating_buffer.end(); it++) {
+    next = std::min(next, std::max(m_device.get_ready_clk(m_cmd_act2, it->addr_vec), m_clk + 1));
+  }
+  return next;
+}
+
 bool LPDDRControllerBase::is_access_cmd(int cmd) const {
   return cmd == m_cmd_rd || cmd == m_cmd_wr || cmd == m_cmd_rda || cmd == m_cmd_wra ||
          cmd == m_cmd_rd_l || cmd == m_cmd_wr_l || cmd == m_cmd_rda_l || cmd == m_cmd_wra_l;
@@ -15,6 +15,7 @@ class LPDDRControllerBase : public ControllerBase {
   void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override;
   void tick() override;
   void reset_stats() override;
+  Clk_t get_next_event_clk() override;
 
  protected:
   LPDDRControllerBase(const ConfigNode& config, Implementation* parent)
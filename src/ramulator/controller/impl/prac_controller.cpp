@@ -89,6 +89,11 @@ class PRACController : public ControllerBase {
 
   void tick() override;
 
+  // The ABO state machine is clocked on every tick; never fast-forward.
+  Clk_t get_next_event_clk() override {
+    return m_clk + 1;
+  }
+
  private:
   // ABO state machine
   enum class ABOState { NORMAL, PRE_RECOVERY, RECOVERY, DELAY };
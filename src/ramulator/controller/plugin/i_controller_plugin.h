@@ -17,6 +17,10 @@ class ControllerBase;
 //   on_issue(req):            Be notified about the command issued to DRAM
 //
 //   post_schedule():          Things that happens at the end of memory controller tick
+//
+// get_next_event_clk(clk) reports the earliest cycle after clk at which pre_schedule() or
+// post_schedule() may act, so the controller can fast-forward over idle cycles. Plugins that
+// act in those hooks must override it.
 class IControllerPlugin {
   RAMULATOR_REGISTER_INTERFACE(IControllerPlugin, "controller_plugin")
  public:
@@ -26,6 +30,9 @@ class IControllerPlugin {
   }
   virtual void post_schedule() {
   }
+  virtual Clk_t get_next_event_clk(Clk_t clk) {
+    return CLK_NEVER;
+  }
 };
 
 }  // namespace Ramulator
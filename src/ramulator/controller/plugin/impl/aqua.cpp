@@ -132,6 +132,11 @@ class AQUA : public IControllerPlugin, public Implementation {
     }
   }
 
+  // The epoch counter advances in every pre_schedule(), so no cycle can be skipped.
+  Clk_t get_next_event_clk(Clk_t clk) override {
+    return clk + 1;
+  }
+
   void on_issue(const Request& req) override {
     auto* spec = m_ctrl->m_device.m_spec;
 
@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "ramulator/base/base.h"
+#include "ramulator/base/param.h"
+#include "ramulator/controller/controller_base.h"
+#include "ramulator/controller/plugin/i_controller_plugin.h"
+#include "ramulator/dram/device.h"
+#include "ramulator/dram/dram_spec.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    ChargeCache: recently activated rows still hold a high charge, so they open faster.
+ *
+ * A set-associative, LRU Highly-Charged Row Address Cache (HCRAC) remembers rows activated within
+ * the last caching_duration_ns. An activation that hits in the HCRAC gets nRCD (to the column
+ * commands) and nRAS (to PREpb, and thus nRC to the next ACT) shortened for that row only.
+ * Rows are recorded when activated: they are fully restored by the time they close, so counting
+ * the duration from the activation is conservative.
+ */
+class ChargeCache : public IControllerPlugin, public ILatencyOverride, public Implementation {
+  RAMULATOR_REGISTER_IMPLEMENTATION(IControllerPlugin, ChargeCache, "ChargeCache")
+
+ private:
+  struct Entry {
+    int64_t row = -1;
+    Clk_t inserted = -1;
+    Clk_t last_used = -1;
+  };
+
+  ControllerBase* m_ctrl = nullptr;
+
+  int m_num_entries = -1;
+  int m_associativity = -1;
+  float m_caching_duration_ns = -1;
+  float m_rcd_reduction_ns = -1;
+  float m_ras_reduction_ns = -1;
+
+  Clk_t m_caching_duration_clk = -1;
+  int m_rcd_reduction_clk = 0;
+  int m_ras_reduction_clk = 0;
+
+  int m_bank_level = -1;
+  int m_row_level = -1;
+
+  std::vector<int> m_rcd_cmds;  // Commands gated by nRCD (column accesses)
+  std::vector<int> m_ras_cmds;  // Commands gated by nRAS/nRC (PREpb, ACT)
+
+  int m_num_sets = 0;
+  std::vector<Entry> m_hcrac;  // [set][way]
+
+  size_t s_num_hits = 0;
+  size_t s_num_misses = 0;
+
+ public:
+  void init() override {
+    RAMULATOR_PARSE_PARAM(m_num_entries, int, "num_entries").default_val(128);
+    RAMULATOR_PARSE_PARAM(m_associativity, int, "associativity").default_val(2);
+    RAMULATOR_PARSE_PARAM(m_caching_duration_ns, float, "caching_duration_ns").default_val(1000000.0f);
+    RAMULATOR_PARSE_PARAM(m_rcd_reduction_ns, float, "rcd_reduction_ns").default_val(5.0f);
+    RAMULATOR_PARSE_PARAM(m_ras_reduction_ns, float, "ras_reduction_ns").default_val(10.0f);
+
+    if (m_num_entries <= 0 || m_associativity <= 0 || m_num_entries % m_associativity != 0) {
+      throw std::runtime_error("ChargeCache: num_entries must be a positive multiple of associativity");
+    }
+    if (m_caching_duration_ns <= 0 || m_rcd_reduction_ns < 0 || m_ras_reduction_ns < 0) {
+      throw std::runtime_error("ChargeCache: invalid caching duration or latency reduction");
+    }
+  }
+
+  void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
+    m_ctrl = cast_parent<ControllerBase>();
+    auto* spec = m_ctrl->m_device.m_spec;
+
+    if (!spec->has_level("Row") || !spec->has_timing("nRCD") || !spec->has_timing("nRAS")) {
+      throw std::runtime_error("ChargeCache needs a DRAM standard with rows and nRCD/nRAS timings");
+    }
+
+    float tCK_ns = spec->get_timing_value("tCK_ps") / 1000.0f;
+    m_caching_duration_clk = static_cast<Clk_t>(m_caching_duration_ns / tCK_ns);
+    // Round down so a reduction never exceeds the configured one
+    m_rcd_reduction_clk = static_cast<int>(std::floor(m_rcd_reduction_ns / tCK_ns));
+    m_ras_reduction_clk = static_cast<int>(std::floor(m_ras_reduction_ns / tCK_ns));
+    if (m_rcd_reduction_clk >= spec->get_timing_value("nRCD") || m_ras_reduction_clk >= spec->get_timing_value("nRAS")) {
+      throw std::runtime_error("ChargeCache: latency reduction must be shorter than nRCD/nRAS");
+    }
+
+    m_bank_level = spec->get_level_id("Bank");
+    m_row_level = spec->get_level_id("Row");
+
+    for (int cmd = 0; cmd < static_cast<int>(spec->command_meta.size()); cmd++) {
+      const DRAMCommandMeta& meta = spec->command_meta[cmd];
+      if (meta.is_accessing) {
+        m_rcd_cmds.push_back(cmd);
+      } else if (meta.is_opening || (meta.is_closing && spec->bank_targets[cmd] == BankTarget::Single)) {
+        m_ras_cmds.push_back(cmd);
+      }
+    }
+
+    m_num_sets = m_num_entries / m_associativity;
+    m_hcrac.assign(m_num_entries, Entry{});
+
+    m_ctrl->m_device.add_latency_override(this);
+
+    m_stats.add("charge_cache_hits", s_num_hits);
+    m_stats.add("charge_cache_misses", s_num_misses);
+  }
+
+  bool reduce(int command, const AddrVec_t& addr_vec, Clk_t clk, int* reductions) override {
+    for (int lvl = 1; lvl <= m_row_level; lvl++) {
+      if (addr_vec[lvl] < 0) return false;
+    }
+    // Flat row id, counting any levels between Bank and Row (e.g., subarrays)
+    int64_t row = m_ctrl->m_device.get_flat_bank_id(addr_vec);
+    for (int lvl = m_bank_level + 1; lvl <= m_row_level; lvl++) {
+      row = row * m_ctrl->m_device.m_spec->organization.level_sizes[lvl] + addr_vec[lvl];
+    }
+
+    bool hit = lookup_and_insert(row, clk);
+    if (!hit) {
+      s_num_misses++;
+      return false;
+    }
+
+    s_num_hits++;
+    for (int cmd : m_rcd_cmds) {
+      reductions[cmd] = std::max(reductions[cmd], m_rcd_reduction_clk);
+    }
+    for (int cmd : m_ras_cmds) {
+      reductions[cmd] = std::max(reductions[cmd], m_ras_reduction_clk);
+    }
+    return true;
+  }
+
+ private:
+  // Whether the row is still highly charged; (re)records it as activated at clk either way
+  bool lookup_and_insert(int64_t row, Clk_t clk) {
+    Entry* set = &m_hcrac[static_cast<size_t>(row % m_num_sets) * m_associativity];
+    Entry* victim = &set[0];
+    for (int way = 0; way < m_associativity; way++) {
+      Entry& e = set[way];
+      if (e.row == row) {
+        bool hit = clk - e.inserted <= m_caching_duration_clk;
+        e.inserted = clk;
+        e.last_used = clk;
+        return hit;
+      }
+      if (e.row < 0 || (victim->row >= 0 && e.last_used < victim->last_used)) {
+        victim = &e;
+      }
+    }
+    *victim = Entry{row, clk, clk};
+    return false;
+  }
+};
+
+}  // namespace Ramulator
@@ -90,6 +90,11 @@ class Graphene : public IControllerPlugin, public Implementation {
     }
   }
 
+  // Table resets are driven by a per-tick counter; never skip cycles.
+  Clk_t get_next_event_clk(Clk_t clk) override {
+    return clk + 1;
+  }
+
   void on_issue(const Request& req) override {
     auto* spec = m_ctrl->m_device.m_spec;
 
@@ -254,6 +254,11 @@ class Hydra : public IControllerPlugin, public Implementation {
     }
   }
 
+  // pre_schedule() counts cycles towards the next table reset; keep ticking.
+  Clk_t get_next_event_clk(Clk_t clk) override {
+    return clk + 1;
+  }
+
   void on_issue(const Request& req) override {
     auto* spec = m_ctrl->m_device.m_spec;
 
@@ -26,6 +26,11 @@ class IssuedCommandValidationHook final
     m_issued_commands_this_tick.clear();
   }
 
+  // The per-tick record is cleared every cycle and read back after each tick.
+  Clk_t get_next_event_clk(Clk_t clk) override {
+    return clk + 1;
+  }
+
   void on_issue(const Request& req) override {
     m_issued_commands_this_tick.push_back({
         .clk = m_ctrl->m_clk,
@@ -91,6 +91,11 @@ class LiveTraceStreamer : public IControllerPlugin, public Implementation {
     }
   }
 
+  Clk_t get_next_event_clk(Clk_t clk) override {
+    // Buffered events are flushed from post_schedule() once the tick/time interval elapses.
+    return m_clk_buf.empty() ? CLK_NEVER : clk + 1;
+  }
+
   void finalize() override {
     if (!m_interrupted) {
       if (!m_clk_buf.empty()) flush_events();
@@ -122,6 +122,11 @@ class RRS : public IControllerPlugin, public Implementation {
     }
   }
 
+  // Epoch resets are counted in pre_schedule(); every cycle must be ticked.
+  Clk_t get_next_event_clk(Clk_t clk) override {
+    return clk + 1;
+  }
+
   void on_issue(const Request& req) override {
     auto* spec = m_ctrl->m_device.m_spec;
 
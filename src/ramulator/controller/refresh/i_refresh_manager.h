@@ -11,6 +11,12 @@ class IRefreshManager {
  public:
   // Called every controller clock cycle to check if a refresh is due.
   virtual void tick() = 0;
+
+  // Earliest controller cycle after `clk` at which tick() may act (CLK_NEVER if none).
+  // Used for idle fast-forward; the default never lets the controller skip ahead.
+  virtual Clk_t get_next_event_clk(Clk_t clk) {
+    return clk + 1;
+  }
 };
 
 }  // namespace Ramulator
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <array>
 #include <iostream>
 #include <stdexcept>
@@ -15,9 +16,11 @@
 namespace Ramulator {
 namespace {
 
-constexpr std::array<std::pair<std::string_view, std::string_view>, 11> all_bank_refresh_scopes = {{
+constexpr std::array<std::pair<std::string_view, std::string_view>, 13> all_bank_refresh_scopes = {{
     {"DDR3", "Rank"},
     {"DDR4", "Rank"},
+    {"DDR4_RowClone", "Rank"},
+    {"DDR4_SALP", "Rank"},
     {"DDR5", "Rank"},
     {"LPDDR5", "Rank"},
     {"LPDDR6", "Rank"},
@@ -77,6 +80,7 @@ class AllBankRefresh : public IRefreshManager, public Implementation {
   AddrVec_t build_addr_vec(DRAMNode* node);
   void init() override;
   void tick() override;
+  Clk_t get_next_event_clk(Clk_t clk) override;
 
   void tick_all_at_once();
   void tick_scattered();
@@ -157,6 +161,20 @@ void AllBankRefresh::tick() {
   }
 }
 
+Clk_t AllBankRefresh::get_next_event_clk(Clk_t clk) {
+  // Refreshes fire only when m_clk matches exactly, so a deadline at or before clk never fires.
+  if (!m_scatter_enabled) {
+    return m_next_refresh_cycle > clk ? m_next_refresh_cycle : CLK_NEVER;
+  }
+  Clk_t next = CLK_NEVER;
+  for (Clk_t cycle : m_next_scattered_refresh_cycles) {
+    if (cycle > clk) {
+      next = std::min(next, cycle);
+    }
+  }
+  return next;
+}
+
 void AllBankRefresh::send_refresh(DRAMNode* ref_node) {
   AddrVec_t addr_vec = build_addr_vec(ref_node);
   Request req(addr_vec, Request::Cmd, m_cmd_refab);
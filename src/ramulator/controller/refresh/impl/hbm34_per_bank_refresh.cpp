@@ -65,6 +65,7 @@ class HBM34PerBankRefresh : public IRefreshManager, public Implementation {
  public:
   void init() override;
   void tick() override;
+  Clk_t get_next_event_clk(Clk_t clk) override;
 };
 
 AddrVec_t HBM34PerBankRefresh::build_addr_vec(DRAMNode* node) const {
@@ -200,4 +201,12 @@ void HBM34PerBankRefresh::tick() {
   m_next_refresh_clk += m_nrefipb;
 }
 
+Clk_t HBM34PerBankRefresh::get_next_event_clk(Clk_t clk) {
+  // Queued REFpbs are retried every cycle until the priority buffer accepts them.
+  if (!m_pending_refpbs.empty()) {
+    return clk + 1;
+  }
+  return std::max(m_next_refresh_clk, clk + 1);
+}
+
 }  // namespace Ramulator
@@ -10,6 +10,9 @@ class NoRefresh : public IRefreshManager, public Implementation {
   }
   void tick() override {
   }
+  Clk_t get_next_event_clk(Clk_t clk) override {
+    return CLK_NEVER;
+  }
 };
 
 }  // namespace Ramulator
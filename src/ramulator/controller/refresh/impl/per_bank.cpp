@@ -24,6 +24,7 @@ class PerBankRefresh : public IRefreshManager, public Implementation {
   AddrVec_t build_addr_vec(DRAMNode* node);
   void init() override;
   void tick() override;
+  Clk_t get_next_event_clk(Clk_t clk) override;
 };
 
 AddrVec_t PerBankRefresh::build_addr_vec(DRAMNode* node) {
@@ -65,4 +66,8 @@ void PerBankRefresh::tick() {
   }
 }
 
+Clk_t PerBankRefresh::get_next_event_clk(Clk_t clk) {
+  return m_next_refresh_cycle > clk ? m_next_refresh_cycle : CLK_NEVER;
+}
+
 }  // namespace Ramulator
@@ -21,6 +21,10 @@ namespace Ramulator {
 //                             Examples: Update bank col access counters, counter resets on close.
 //
 //   post_schedule():          Things that happens at the end of memory controller tick
+//
+// get_next_event_clk(clk) reports the earliest cycle after clk at which pre_schedule() or
+// post_schedule() may act, so the controller can fast-forward over idle cycles. Policies that
+// act in those hooks must override it.
 class IRowPolicy {
   RAMULATOR_REGISTER_INTERFACE(IRowPolicy, "row_policy")
  public:
@@ -35,6 +39,10 @@ class IRowPolicy {
 
   virtual void post_schedule() {
   }
+
+  virtual Clk_t get_next_event_clk(Clk_t clk) {
+    return CLK_NEVER;
+  }
 };
 
 }  // namespace Ramulator
@@ -131,6 +131,16 @@ class ClosedCAPRowPolicy : public IRowPolicy, public Implementation {
       }
     }
   }
+
+  Clk_t get_next_event_clk(Clk_t clk) override {
+    // Any bank still waiting for its fallback PREpb is polled every cycle.
+    for (int i = 0; i < static_cast<int>(m_col_accesses.size()); i++) {
+      if (m_col_accesses[i] >= m_cap && !m_prepb_injected[i]) {
+        return clk + 1;
+      }
+    }
+    return CLK_NEVER;
+  }
 };
 
 }  // namespace Ramulator
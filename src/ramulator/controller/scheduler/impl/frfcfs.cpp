@@ -19,27 +19,30 @@ class FRFCFSScheduler : public IScheduler, public Implementation {
       return buffer.end();
     }
 
+    // Derive the current command (prerequisite resolution), then check timing of the whole buffer
+    for (auto it = buffer.begin(); it != buffer.end(); it++) {
+      it->command = m_ctrl->get_preq_command(*it);
+    }
+    const auto& ready = m_ctrl->check_timing_batch(buffer);
+
     auto candidate = buffer.end();
     bool cand_timing_ok = false;
 
-    for (auto it = buffer.begin(); it != buffer.end(); it++) {
-      // Derive the current command (prerequisite resolution)
-      it->command = m_ctrl->get_preq_command(it->final_command, it->addr_vec);
-
+    size_t i = 0;
+    for (auto it = buffer.begin(); it != buffer.end(); it++, i++) {
       // Apply eligibility filter
       if (filter && !filter(*it)) {
         continue;
       }
 
-      // First eligible candidate — take it, check timing once
+      bool it_timing_ok = (ready[i / 64] >> (i % 64)) & 1;
       if (candidate == buffer.end()) {
         candidate = it;
-        cand_timing_ok = m_ctrl->check_timing(it->command, it->addr_vec);
+        cand_timing_ok = it_timing_ok;
         continue;
       }
 
-      // Compare challenger against incumbent (incumbent timing is cached)
-      bool it_timing_ok = m_ctrl->check_timing(it->command, it->addr_vec);
+      // Compare challenger against incumbent
       if (cand_timing_ok != it_timing_ok) {
         if (it_timing_ok) {
           candidate = it;
@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "ramulator/controller/controller_base.h"
+#include "ramulator/controller/scheduler/i_scheduler.h"
+
+namespace Ramulator {
+
+// FRFCFS that caches each buffered request's prerequisite command and ready clock.
+// Picks exactly what FRFCFS picks, but re-derives the cached answers only when the device
+// reports a change that can affect them:
+//   - command:   the target bank's state changed (DRAMDevice::m_bank_state_epochs), or any
+//                bank's state for multi-bank commands (DRAMDevice::m_state_epoch)
+//   - ready clk: ready clocks only ever grow, so a cached ready clock is a lower bound; a request
+//                with m_clk below it is not ready, and one at or past it is ready unless a
+//                command was issued since (DRAMDevice::m_issue_epoch)
+// When no request in a buffer is ready, the earliest cached ready clock is remembered, and until
+// then (or a buffer/bank state change) the buffer is answered without a scan.
+// Returns end() when no eligible request is timing-ready, which the controller would discard.
+class FRFCFSIncrementalScheduler : public IScheduler, public Implementation {
+  RAMULATOR_REGISTER_IMPLEMENTATION(IScheduler, FRFCFSIncrementalScheduler, "FRFCFS-Incremental")
+
+  struct Entry {
+    uint64_t stamp = 0;        // ReqBuffer stamp of the request this entry describes (0 = none)
+    int flat_bank_id = -1;     // Target bank for single-bank commands, -1 otherwise
+    int command = -1;          // Cached get_preq_command()
+    uint64_t state_epoch = 0;  // m_state_epoch when command was derived
+    Clk_t ready_clk = -1;      // Cached get_ready_clk(command); a lower bound once stale
+    uint64_t issue_epoch = 0;  // m_issue_epoch when ready_clk was computed
+  };
+
+  struct BufferCache {
+    const ReqBuffer* buffer = nullptr;
+    std::vector<Entry> entries;  // Indexed by ReqBuffer slot
+    // "Nothing ready before wake_clk", valid while the buffer and bank states are unchanged
+    Clk_t wake_clk = -1;
+    uint64_t version = 0;
+    uint64_t state_epoch = 0;
+  };
+
+  ControllerBase* m_ctrl = nullptr;
+  DRAMDevice* m_device = nullptr;
+  std::vector<BufferCache> m_caches;  // One per buffer the controller schedules from (a handful)
+
+  void init() override {
+    m_ctrl = cast_parent<ControllerBase>();
+    m_device = &m_ctrl->m_device;
+  }
+
+  ReqBuffer::iterator get_best_request(ReqBuffer& buffer, RequestFilterRef filter) override {
+    if (buffer.size() == 0) {
+      return buffer.end();
+    }
+
+    BufferCache& cache = get_cache(buffer);
+    const Clk_t clk = m_ctrl->m_clk;
+    if (cache.wake_clk > clk && cache.version == buffer.version() &&
+        cache.state_epoch == m_device->m_state_epoch) {
+      return buffer.end();
+    }
+    if (cache.entries.size() < buffer.num_slots()) {
+      cache.entries.resize(buffer.num_slots());
+    }
+
+    auto candidate = buffer.end();
+    bool any_ready = false;
+    Clk_t wake_clk = CLK_NEVER;
+
+    for (auto it = buffer.begin(); it != buffer.end(); it++) {
+      Entry& e = cache.entries[it.slot()];
+      refresh_command(e, it);
+      it->command = e.command;
+
+      if (!is_ready(e, *it, clk)) {
+        wake_clk = std::min(wake_clk, e.ready_clk);
+        continue;
+      }
+      any_ready = true;
+
+      // Ready requests are ranked by arrival (first in buffer order on ties); the filter is
+      // eligibility-only, so it is consulted only for a request that would become the candidate.
+      if (candidate != buffer.end() && it->arrive >= candidate->arrive) {
+        continue;
+      }
+      if (filter && !filter(*it)) {
+        continue;
+      }
+      candidate = it;
+    }
+
+    if (!any_ready) {
+      cache.wake_clk = wake_clk;
+      cache.version = buffer.version();
+      cache.state_epoch = m_device->m_state_epoch;
+    } else {
+      cache.wake_clk = -1;
+    }
+    return candidate;
+  }
+
+  BufferCache& get_cache(const ReqBuffer& buffer) {
+    for (auto& cache : m_caches) {
+      if (cache.buffer == &buffer) {
+        return cache;
+      }
+    }
+    m_caches.emplace_back().buffer = &buffer;
+    return m_caches.back();
+  }
+
+  // Re-derive the prerequisite command if the entry is new or its bank state may have changed.
+  void refresh_command(Entry& e, ReqBuffer::iterator it) {
+    if (e.stamp == it.stamp()) {
+      uint64_t changed = (e.flat_bank_id >= 0) ? m_device->m_bank_state_epochs[e.flat_bank_id]
+                                               : m_device->m_state_epoch;
+      if (changed <= e.state_epoch) {
+        return;
+      }
+    } else {
+      e.stamp = it.stamp();
+      e.flat_bank_id = (m_device->m_spec->bank_targets[it->final_command] == BankTarget::Single)
+                           ? m_device->get_flat_bank_id(it->addr_vec)
+                           : -1;
+      e.command = -1;
+    }
+
+    int command = m_ctrl->get_preq_command(it->final_command, it->addr_vec);
+    e.state_epoch = m_device->m_state_epoch;
+    if (command != e.command) {
+      e.command = command;
+      e.ready_clk = m_device->get_ready_clk(command, it->addr_vec);
+      e.issue_epoch = m_device->m_issue_epoch;
+    }
+  }
+
+  bool is_ready(Entry& e, const Request& req, Clk_t clk) {
+    if (clk < e.ready_clk) {
+      return false;
+    }
+    if (e.issue_epoch != m_device->m_issue_epoch) {
+      e.ready_clk = m_device->get_ready_clk(e.command, req.addr_vec);
+      e.issue_epoch = m_device->m_issue_epoch;
+    }
+    return clk >= e.ready_clk;
+  }
+};
+
+}  // namespace Ramulator
@@ -7,8 +7,8 @@
 namespace Ramulator {
 
 // FRFCFS with row-hit prioritization.
-// Scans the buffer twice: first to identify row-hits
-// then do FRFCFS that prevents a row-hit from being preempted by a non-row-hit.
+// Scans the buffer to identify row-hits, then resolves commands and batch-checks their timing,
+// then does FRFCFS that prevents a row-hit from being preempted by a non-row-hit.
 // For example, for DRAM with nRTP < nCCD_L, as long as nRAS has passed,
 // accesses to another row will preempt following RDs to the same opened row.
 class FRFCFSRowHitScheduler : public IScheduler, public Implementation {
@@ -31,28 +31,37 @@ class FRFCFSRowHitScheduler : public IScheduler, public Implementation {
       return buffer.end();
     }
 
-    std::fill(m_bank_rowhit_flags.begin(), m_bank_rowhit_flags.end(), false);
-
-    // Pass 1: resolve prerequisites and record all row-hits.
-    for (auto it = buffer.begin(); it != buffer.end(); it++) {
-      it->command = m_ctrl->get_preq_command(it->final_command, it->addr_vec);
-      
-      if (m_ctrl->m_device.check_rowbuffer_hit(it->final_command, it->addr_vec, m_ctrl->m_clk)) {
+    // Pass 1: record the earliest row-hit of every bank.
+    if (buffer.is_bank_indexed()) {
+      // Only banks with requests are visited; flags of the others are never read.
+      for (int bank_id : buffer.busy_banks()) {
+        m_bank_rowhit_flags[bank_id] = false;
+        for (auto& req : buffer.bank_requests(bank_id)) {
+          record_rowhit(req, bank_id);
+        }
+      }
+    } else {
+      std::fill(m_bank_rowhit_flags.begin(), m_bank_rowhit_flags.end(), false);
+      for (auto it = buffer.begin(); it != buffer.end(); it++) {
         const int bank_id = m_ctrl->m_device.get_flat_bank_id(it->addr_vec);
         if (bank_id >= 0 && bank_id < static_cast<int>(m_bank_rowhit_flags.size())) {
-          if (!m_bank_rowhit_flags[bank_id] || it->arrive < m_bank_rowhit_arrivals[bank_id]) {
-            m_bank_rowhit_flags[bank_id] = true;
-            m_bank_rowhit_arrivals[bank_id] = it->arrive;
-          }
+          record_rowhit(*it, bank_id);
         }
       }
     }
 
-    // Pass 2: FRFCFS with row-hit preemption blocking.
+    // Pass 2: resolve prerequisites and check timing of the whole buffer.
+    for (auto it = buffer.begin(); it != buffer.end(); it++) {
+      it->command = m_ctrl->get_preq_command(*it);
+    }
+    const auto& ready = m_ctrl->check_timing_batch(buffer);
+
+    // Pass 3: FRFCFS with row-hit preemption blocking.
     auto candidate = buffer.end();
     bool cand_timing_ok = false;
 
-    for (auto it = buffer.begin(); it != buffer.end(); it++) {
+    size_t i = 0;
+    for (auto it = buffer.begin(); it != buffer.end(); it++, i++) {
       if (filter && !filter(*it)) {
         continue;
       }
@@ -61,13 +70,13 @@ class FRFCFSRowHitScheduler : public IScheduler, public Implementation {
         continue;
       }
 
+      bool it_timing_ok = (ready[i / 64] >> (i % 64)) & 1;
       if (candidate == buffer.end()) {
         candidate = it;
-        cand_timing_ok = m_ctrl->check_timing(it->command, it->addr_vec);
+        cand_timing_ok = it_timing_ok;
         continue;
       }
 
-      bool it_timing_ok = m_ctrl->check_timing(it->command, it->addr_vec);
       if (cand_timing_ok != it_timing_ok) {
         if (it_timing_ok) {
           candidate = it;
@@ -81,6 +90,16 @@ class FRFCFSRowHitScheduler : public IScheduler, public Implementation {
     return candidate;
   }
 
+  void record_rowhit(const Request& req, int bank_id) {
+    if (!m_ctrl->m_device.check_rowbuffer_hit(req.final_command, req.addr_vec, m_ctrl->m_clk)) {
+      return;
+    }
+    if (!m_bank_rowhit_flags[bank_id] || req.arrive < m_bank_rowhit_arrivals[bank_id]) {
+      m_bank_rowhit_flags[bank_id] = true;
+      m_bank_rowhit_arrivals[bank_id] = req.arrive;
+    }
+  }
+
   bool would_preempt_rowhit(const Request& req) const {
     const auto& spec = *m_ctrl->m_device.m_spec;
     if (!spec.command_meta[req.command].is_closing) {
@@ -3,6 +3,7 @@
 
 #include <stdexcept>
 
+#include "ramulator/dram/commands/subarray.h"
 #include "ramulator/dram/node.h"
 
 namespace Ramulator::Cmd {
@@ -14,15 +15,35 @@ struct ACT {
 
   static void action(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     bank->m_state = T::State::Opened;
-    bank->m_row_state[addr_vec[T::Level::Row]] = T::State::Opened;
+    if constexpr (HasSubarrays<T>) {
+      DRAMNode* subarray = Subarrays<T>::of(bank, addr_vec);
+      Subarrays<T>::select(bank, subarray);
+      subarray->open_row(addr_vec[T::Level::Row]);
+    } else {
+      bank->open_row(addr_vec[T::Level::Row]);
+    }
   }
 
   static int preq(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
+    if constexpr (HasSubarrays<T>) {
+      // Other subarrays' open rows do not conflict; an open row must be selected before access
+      DRAMNode* subarray = Subarrays<T>::of(bank, addr_vec);
+      switch (subarray->m_state) {
+        case T::State::Closed:
+          return T::Command::ACT;
+        case T::State::Opened:
+          return subarray->is_row_open(addr_vec[T::Level::Row]) ? T::Command::SASEL : T::Command::PREpb;
+        case T::State::Selected:
+          return subarray->is_row_open(addr_vec[T::Level::Row]) ? cmd : T::Command::PREpb;
+        default:
+          throw std::runtime_error("[ACT] Invalid subarray state!");
+      }
+    }
     switch (bank->m_state) {
       case T::State::Closed:
         return T::Command::ACT;
       case T::State::Opened:
-        if (bank->m_row_state.find(addr_vec[T::Level::Row]) != bank->m_row_state.end()) {
+        if (bank->is_row_open(addr_vec[T::Level::Row])) {
           return cmd;
         } else {
           return T::Command::PREpb;
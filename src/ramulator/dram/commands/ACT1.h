@@ -23,7 +23,7 @@ struct ACT1 {
       case T::State::Activating:
         return cmd;
       case T::State::Opened:
-        if (bank->m_row_state.find(addr_vec[T::Level::Row]) != bank->m_row_state.end()) {
+        if (bank->is_row_open(addr_vec[T::Level::Row])) {
           return cmd;
         }
         return T::Command::PREpb;
@@ -14,7 +14,7 @@ struct ACT2 {
 
   static void action(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     bank->m_state = T::State::Opened;
-    bank->m_row_state[addr_vec[T::Level::Row]] = T::State::Opened;
+    bank->open_row(addr_vec[T::Level::Row]);
   }
 
   static int preq(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
@@ -24,7 +24,7 @@ struct ACT2 {
       case T::State::Activating:
         return T::Command::ACT2;
       case T::State::Opened:
-        if (bank->m_row_state.find(addr_vec[T::Level::Row]) != bank->m_row_state.end()) {
+        if (bank->is_row_open(addr_vec[T::Level::Row])) {
           return cmd;
         }
         return T::Command::PREpb;
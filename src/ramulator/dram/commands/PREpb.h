@@ -1,6 +1,7 @@
 #ifndef RAMULATOR_DRAM_COMMANDS_PREPB_H
 #define RAMULATOR_DRAM_COMMANDS_PREPB_H
 
+#include "ramulator/dram/commands/subarray.h"
 #include "ramulator/dram/node.h"
 
 namespace Ramulator::Cmd {
@@ -11,8 +12,13 @@ struct PREpb {
   static constexpr BankTarget bank_target = BankTarget::Single;
 
   static void action(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
-    bank->m_state = T::State::Closed;
-    bank->m_row_state.clear();
+    if constexpr (HasSubarrays<T>) {
+      // Precharges only the addressed subarray
+      Subarrays<T>::close(bank, addr_vec);
+    } else {
+      bank->m_state = T::State::Closed;
+      bank->close_rows();
+    }
   }
 
   static int preq(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
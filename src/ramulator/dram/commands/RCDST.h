@@ -0,0 +1,31 @@
+#ifndef RAMULATOR_DRAM_COMMANDS_RCDST_H
+#define RAMULATOR_DRAM_COMMANDS_RCDST_H
+
+#include "ramulator/dram/commands/RD.h"
+#include "ramulator/dram/node.h"
+
+namespace Ramulator::Cmd {
+
+// RowClone Pipelined Serial Mode, destination side: write the lines streamed from another bank's
+// open row (RCSRC) into the open row
+template <class T>
+struct RCDST {
+  static constexpr DRAMCommandMeta meta = {.is_accessing = true};
+  static constexpr BankTarget bank_target = BankTarget::Single;
+
+  static int preq(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
+    return RD<T>::preq(bank, cmd, addr_vec, clk);
+  }
+
+  static bool rowhit(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
+    return RD<T>::rowhit(bank, cmd, addr_vec, clk);
+  }
+
+  static bool rowopen(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
+    return RD<T>::rowopen(bank, cmd, addr_vec, clk);
+  }
+};
+
+}  // namespace Ramulator::Cmd
+
+#endif  // RAMULATOR_DRAM_COMMANDS_RCDST_H
@@ -0,0 +1,25 @@
+#ifndef RAMULATOR_DRAM_COMMANDS_RCFPM_H
+#define RAMULATOR_DRAM_COMMANDS_RCFPM_H
+
+#include "ramulator/dram/node.h"
+
+namespace Ramulator::Cmd {
+
+// RowClone Fast Parallel Mode: copy a row into the addressed row of the same subarray through the
+// shared sense amplifiers (back-to-back ACT src, ACT dst, then PRE). The bank ends precharged.
+template <class T>
+struct RCFPM {
+  static constexpr DRAMCommandMeta meta = {};
+  static constexpr BankTarget bank_target = BankTarget::Single;
+
+  static int preq(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
+    if (bank->m_state != T::State::Closed) {
+      return T::Command::PREpb;
+    }
+    return cmd;
+  }
+};
+
+}  // namespace Ramulator::Cmd
+
+#endif  // RAMULATOR_DRAM_COMMANDS_RCFPM_H
@@ -0,0 +1,31 @@
+#ifndef RAMULATOR_DRAM_COMMANDS_RCSRC_H
+#define RAMULATOR_DRAM_COMMANDS_RCSRC_H
+
+#include "ramulator/dram/commands/RD.h"
+#include "ramulator/dram/node.h"
+
+namespace Ramulator::Cmd {
+
+// RowClone Pipelined Serial Mode, source side: stream the open row out over the chip's internal
+// bus, one cache line per TRANSFER, without using the channel's data bus
+template <class T>
+struct RCSRC {
+  static constexpr DRAMCommandMeta meta = {.is_accessing = true};
+  static constexpr BankTarget bank_target = BankTarget::Single;
+
+  static int preq(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
+    return RD<T>::preq(bank, cmd, addr_vec, clk);
+  }
+
+  static bool rowhit(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
+    return RD<T>::rowhit(bank, cmd, addr_vec, clk);
+  }
+
+  static bool rowopen(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
+    return RD<T>::rowopen(bank, cmd, addr_vec, clk);
+  }
+};
+
+}  // namespace Ramulator::Cmd
+
+#endif  // RAMULATOR_DRAM_COMMANDS_RCSRC_H
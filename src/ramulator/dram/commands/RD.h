@@ -3,6 +3,7 @@
 
 #include "ramulator/dram/commands/ACT.h"
 #include "ramulator/dram/commands/ACT2.h"
+#include "ramulator/dram/commands/subarray.h"
 #include "ramulator/dram/node.h"
 
 namespace Ramulator::Cmd {
@@ -22,11 +23,18 @@ struct RD {
   }
 
   static bool rowhit(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
+    if constexpr (HasSubarrays<T>) {
+      DRAMNode* subarray = Subarrays<T>::of(bank, addr_vec);
+      return subarray->m_state != T::State::Closed && subarray->is_row_open(addr_vec[T::Level::Row]);
+    }
     return bank->m_state == T::State::Opened &&
-           bank->m_row_state.find(addr_vec[T::Level::Row]) != bank->m_row_state.end();
+           bank->is_row_open(addr_vec[T::Level::Row]);
   }
 
   static bool rowopen(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
+    if constexpr (HasSubarrays<T>) {
+      return Subarrays<T>::of(bank, addr_vec)->m_state != T::State::Closed;
+    }
     return bank->m_state == T::State::Opened;
   }
 };
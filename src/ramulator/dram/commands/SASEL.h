@@ -0,0 +1,22 @@
+#ifndef RAMULATOR_DRAM_COMMANDS_SASEL_H
+#define RAMULATOR_DRAM_COMMANDS_SASEL_H
+
+#include "ramulator/dram/commands/subarray.h"
+#include "ramulator/dram/node.h"
+
+namespace Ramulator::Cmd {
+
+// Subarray select (MASA): connect an already activated subarray to the bank's global bitlines
+template <class T>
+struct SASEL {
+  static constexpr DRAMCommandMeta meta = {};
+  static constexpr BankTarget bank_target = BankTarget::Single;
+
+  static void action(DRAMNode* bank, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
+    Subarrays<T>::select(bank, Subarrays<T>::of(bank, addr_vec));
+  }
+};
+
+}  // namespace Ramulator::Cmd
+
+#endif  // RAMULATOR_DRAM_COMMANDS_SASEL_H
@@ -0,0 +1,48 @@
+#ifndef RAMULATOR_DRAM_COMMANDS_SUBARRAY_H
+#define RAMULATOR_DRAM_COMMANDS_SUBARRAY_H
+
+#include "ramulator/dram/node.h"
+
+namespace Ramulator::Cmd {
+
+// Standards with a Subarray level between Bank and Row (SALP/MASA)
+template <class T>
+concept HasSubarrays = requires { T::Level::Subarray; };
+
+// Subarray state of a bank (MASA): every subarray node keeps its own open row, and at most one
+// activated subarray is Selected (drives the bank's global bitlines). The bank node stays
+// Opened while any of its subarrays is.
+template <class T>
+struct Subarrays {
+  static DRAMNode* of(DRAMNode* bank, const AddrVec_t& addr_vec) {
+    return bank->m_child_nodes[addr_vec[T::Level::Subarray]].get();
+  }
+
+  static void select(DRAMNode* bank, DRAMNode* subarray) {
+    for (auto& child : bank->m_child_nodes) {
+      if (child->m_state == T::State::Selected) {
+        child->m_state = T::State::Opened;
+      }
+    }
+    subarray->m_state = T::State::Selected;
+  }
+
+  // Close the addressed subarray (all of them for a wildcard subarray id)
+  static void close(DRAMNode* bank, const AddrVec_t& addr_vec) {
+    int id = addr_vec[T::Level::Subarray];
+    bool any_open = false;
+    for (auto& child : bank->m_child_nodes) {
+      if (id < 0 || child->m_node_id == id) {
+        child->m_state = T::State::Closed;
+        child->close_rows();
+      } else if (child->m_state != T::State::Closed) {
+        any_open = true;
+      }
+    }
+    bank->m_state = any_open ? T::State::Opened : T::State::Closed;
+  }
+};
+
+}  // namespace Ramulator::Cmd
+
+#endif  // RAMULATOR_DRAM_COMMANDS_SUBARRAY_H
@@ -1,26 +1,78 @@
 #include "ramulator/dram/device.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
 namespace Ramulator {
 
-void DRAMDevice::init(std::unique_ptr<DRAMSpec> spec) {
+void DRAMDevice::init(std::shared_ptr<const DRAMSpec> spec, bool lazy_bank_state) {
   m_spec_owner = std::move(spec);
   m_spec = m_spec_owner.get();
+  if (m_spec->level_count > static_cast<int>(AddrVec_t::capacity())) {
+    throw std::runtime_error("DRAMDevice: " + m_spec->standard_name + " has " + std::to_string(m_spec->level_count) +
+                             " levels, more than AddrVec_t holds (" + std::to_string(AddrVec_t::capacity()) + ")");
+  }
   m_bank_level = m_spec->get_level_id("Bank");
+  for (int lvl = 1; lvl <= m_bank_level; lvl++) {
+    m_bank_radix[lvl] = m_spec->organization.level_sizes[lvl];
+  }
+  m_banks_below[m_bank_level] = 1;
+  for (int lvl = m_bank_level - 1; lvl >= 0; lvl--) {
+    m_banks_below[lvl] = m_banks_below[lvl + 1] * m_bank_radix[lvl + 1];
+  }
   m_root = std::make_unique<DRAMNode>(m_spec, nullptr, 0, 0);
   m_root->for_each_at_level(m_bank_level, [&](DRAMNode* bank) { m_bank_nodes.push_back(bank); });
+  m_bank_state_epochs.assign(m_bank_nodes.size(), 0);
+  m_bank_coords.assign(m_bank_nodes.size() * (m_bank_level + 1), 0);
+  for (size_t i = 0; i < m_bank_nodes.size(); i++) {
+    for (auto* n = m_bank_nodes[i]; n->m_parent_node != nullptr; n = n->m_parent_node) {
+      m_bank_coords[i * (m_bank_level + 1) + n->m_level] = n->m_node_id;
+    }
+  }
+
+  // Timing state covers the same levels as the node tree (Channel down to the level above Row)
+  int row_level = m_spec->get_level_id("Row");
+  int num_levels = 1;
+  while (num_levels < row_level && m_spec->organization.level_sizes[num_levels] != 0) {
+    num_levels++;
+  }
+  m_timing.init(m_spec, num_levels, lazy_bank_state);
 }
 
 void DRAMDevice::set_channel_id(int channel_id) {
   m_root->m_node_id = channel_id;
+  m_timing.set_channel_id(channel_id);
 }
 
 void DRAMDevice::issue_command(int command, const AddrVec_t& addr_vec, Clk_t clk) {
-  m_root->update_timing(command, addr_vec, clk);
+  const int* reductions = nullptr;
+  if (!m_latency_overrides.empty() && m_spec->command_meta[command].is_opening) {
+    std::fill(m_reductions.begin(), m_reductions.end(), 0);
+    bool reduced = false;
+    for (ILatencyOverride* latency_override : m_latency_overrides) {
+      reduced |= latency_override->reduce(command, addr_vec, clk, m_reductions.data());
+    }
+    if (reduced) {
+      reductions = m_reductions.data();
+    }
+  }
+  m_timing.update_timing(command, addr_vec, clk, reductions);
+  m_issue_epoch++;
   apply_action(command, addr_vec, clk);
 }
 
+void DRAMDevice::add_latency_override(ILatencyOverride* latency_override) {
+  m_latency_overrides.push_back(latency_override);
+  m_reductions.assign(m_spec->command_meta.size(), 0);
+}
+
 bool DRAMDevice::check_timing(int command, const AddrVec_t& addr_vec, Clk_t clk) {
-  return m_root->check_timing(command, addr_vec, clk);
+  return m_timing.check_timing(command, addr_vec, clk);
+}
+
+Clk_t DRAMDevice::get_ready_clk(int command, const AddrVec_t& addr_vec) const {
+  return m_timing.get_ready_clk(command, addr_vec);
 }
 
 int DRAMDevice::get_preq_command(int command, const AddrVec_t& addr_vec, Clk_t clk) {
@@ -54,23 +106,6 @@ bool DRAMDevice::check_node_open(int command, const AddrVec_t& addr_vec, Clk_t c
   return rowopen_fn(m_bank_nodes[flat_bank_id], command, addr_vec, clk);
 }
 
-int DRAMDevice::get_flat_bank_id(const AddrVec_t& addr_vec) const {
-  int id = 0;
-  for (int lvl = 1; lvl <= m_bank_level; lvl++) {
-    id = id * m_spec->organization.level_sizes[lvl] + addr_vec[lvl];
-  }
-  return id;
-}
-
-bool DRAMDevice::bank_matches(DRAMNode* bank, const AddrVec_t& addr_vec) {
-  for (auto* n = bank; n != nullptr; n = n->m_parent_node) {
-    if (addr_vec[n->m_level] != -1 && addr_vec[n->m_level] != n->m_node_id) {
-      return false;
-    }
-  }
-  return true;
-}
-
 std::vector<int> DRAMDevice::get_target_banks(int command, const AddrVec_t& addr_vec) const {
   std::vector<int> ids;
   for_each_target_bank(command, addr_vec, [&](int id) { ids.push_back(id); });
@@ -80,8 +115,10 @@ std::vector<int> DRAMDevice::get_target_banks(int command, const AddrVec_t& addr
 void DRAMDevice::apply_action(int command, const AddrVec_t& addr_vec, Clk_t clk) {
   auto action_fn = m_spec->funcs.actions[command];
   if (!action_fn) return;
+  m_state_epoch++;
   for_each_target_bank(command, addr_vec, [&](int flat_bank_id) {
     action_fn(m_bank_nodes[flat_bank_id], command, addr_vec, clk);
+    m_bank_state_epochs[flat_bank_id] = m_state_epoch;
   });
 }
 
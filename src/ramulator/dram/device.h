@@ -1,18 +1,33 @@
 #ifndef RAMULATOR_DRAM_DEVICE_H
 #define RAMULATOR_DRAM_DEVICE_H
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 #include "ramulator/base/config_node.h"
+#include "ramulator/base/request.h"
 #include "ramulator/base/type.h"
 #include "ramulator/dram/dram_spec.h"
 #include "ramulator/dram/node.h"
+#include "ramulator/dram/timing_state.h"
 
 namespace Ramulator {
 
 /**
- * @brief    DRAM Device — owns the DRAMSpec, node tree, and flat bank array.
+ * @brief    Per-row timing override, consulted by DRAMDevice on every opening command.
+ *
+ * Lets a mechanism model rows that open faster than nominal (e.g., ChargeCache, AL-DRAM):
+ * reduce() may raise reductions[cmd] (cycles taken off the bank-local constraints from this
+ * command to cmd, all zero on entry) and returns whether it reduced anything.
+ */
+struct ILatencyOverride {
+  virtual ~ILatencyOverride() = default;
+  virtual bool reduce(int command, const AddrVec_t& addr_vec, Clk_t clk, int* reductions) = 0;
+};
+
+/**
+ * @brief    DRAM Device — holds the DRAMSpec, owns the node tree, flat timing state, and flat bank array.
  *
  * Provides all device-level operations: command issue (timing + state),
  * prerequisite checks, row buffer queries. The controller delegates here
@@ -23,24 +38,68 @@ namespace Ramulator {
  */
 class DRAMDevice {
  public:
-  std::unique_ptr<DRAMSpec> m_spec_owner;  // Owns the polymorphic spec
-  DRAMSpec* m_spec = nullptr;              // Non-owning pointer for convenient access
-  std::unique_ptr<DRAMNode> m_root;        // Hierarchical node tree (for timing)
+  std::shared_ptr<const DRAMSpec> m_spec_owner;  // Keeps the (possibly shared, read-only) spec alive
+  const DRAMSpec* m_spec = nullptr;              // Non-owning pointer for convenient access
+  std::unique_ptr<DRAMNode> m_root;        // Hierarchical node tree (for state and scoping)
+  DRAMTimingState m_timing;                // Flat [level][node][cmd] timing state
   std::vector<DRAMNode*> m_bank_nodes;     // Flat bank view (non-owning, for state dispatch)
   int m_bank_level = -1;                   // Cached level ID for "Bank" (hot-path use)
 
-  void init(std::unique_ptr<DRAMSpec> spec);
+  // Change counters for consumers that cache per-request answers (e.g., FRFCFS-Incremental).
+  // Ready clocks only ever grow, so a cached ready clock stays a valid lower bound.
+  uint64_t m_issue_epoch = 0;                 // Bumped on every issued command (ready clocks may have grown)
+  uint64_t m_state_epoch = 0;                 // Bumped on every command that changed bank state
+  std::vector<uint64_t> m_bank_state_epochs;  // Per flat bank: m_state_epoch of its last state change
+
+  // lazy_bank_state: allocate the timing state of the deepest level (Bank) on first use
+  void init(std::shared_ptr<const DRAMSpec> spec, bool lazy_bank_state = false);
   void set_channel_id(int channel_id);
 
-  // Issue a command: update timing (hierarchical) then apply state (flat bank dispatch)
+  // Issue a command: update timing (flat timing state) then apply state (flat bank dispatch)
   void issue_command(int command, const AddrVec_t& addr_vec, Clk_t clk);
 
-  // Timing-only check — hierarchical (walks node tree)
+  // Register a per-row timing override (non-owning); none by default
+  void add_latency_override(ILatencyOverride* latency_override);
+
+  // Timing-only check — walks the addressed path through the flat timing state
   bool check_timing(int command, const AddrVec_t& addr_vec, Clk_t clk);
 
+  // Earliest cycle at which check_timing() would pass (-1 if unconstrained)
+  Clk_t get_ready_clk(int command, const AddrVec_t& addr_vec) const;
+
+  // Batched timing check of single-bank commands, one (command, flat bank id) pair per entry.
+  // Bit i of ready_mask (ceil(n / 64) words, overwritten) is set iff check_timing() would pass
+  // for entry i. Only available when the timing hierarchy ends at Bank (supports_timing_batch()).
+  bool supports_timing_batch() const {
+    return m_timing.supports_batch();
+  }
+  void check_timing_batch(const int* commands, const int* flat_bank_ids, int n, Clk_t clk,
+                          uint64_t* ready_mask) const {
+    m_timing.check_timing_batch(commands, flat_bank_ids, n, clk, ready_mask);
+  }
+
   // Prerequisite check — flat bank dispatch
   int get_preq_command(int command, const AddrVec_t& addr_vec, Clk_t clk);
 
+  // Prerequisite of req.final_command, memoized in req.preq_cache: re-resolved only once the
+  // target bank (single-bank commands) or any bank (All/SameBank) has changed state since.
+  int get_preq_command(Request& req, Clk_t clk) {
+    Request::PreqCache& cache = req.preq_cache;
+    if (cache.final_command == req.final_command) {
+      uint64_t changed = (cache.flat_bank_id >= 0) ? m_bank_state_epochs[cache.flat_bank_id] : m_state_epoch;
+      if (changed <= cache.epoch) {
+        return cache.command;
+      }
+    } else {
+      cache.final_command = req.final_command;
+      bool single = m_spec->bank_targets[req.final_command] == BankTarget::Single && is_bank_addressed(req.addr_vec);
+      cache.flat_bank_id = single ? get_flat_bank_id(req.addr_vec) : -1;
+    }
+    cache.command = get_preq_command(req.final_command, req.addr_vec, clk);
+    cache.epoch = m_state_epoch;
+    return cache.command;
+  }
+
   // Row buffer hit check — flat bank lookup (always single bank)
   bool check_rowbuffer_hit(int command, const AddrVec_t& addr_vec, Clk_t clk);
 
@@ -48,10 +107,54 @@ class DRAMDevice {
   bool check_node_open(int command, const AddrVec_t& addr_vec, Clk_t clk);
 
   // Compute flat bank index from addr_vec
-  int get_flat_bank_id(const AddrVec_t& addr_vec) const;
+  int get_flat_bank_id(const AddrVec_t& addr_vec) const {
+    int id = 0;
+    for (int lvl = 1; lvl <= m_bank_level; lvl++) {
+      id = id * m_bank_radix[lvl] + addr_vec[lvl];
+    }
+    return id;
+  }
+
+  // Whether addr_vec names one bank (no wildcard down to the Bank level)
+  bool is_bank_addressed(const AddrVec_t& addr_vec) const {
+    for (int lvl = 1; lvl <= m_bank_level; lvl++) {
+      if (addr_vec[lvl] < 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Check if a bank matches an addr_vec pattern (wildcards are -1)
+  bool bank_in_scope(int flat_bank_id, const AddrVec_t& addr_vec) const {
+    if (addr_vec[0] != -1 && addr_vec[0] != m_root->m_node_id) {
+      return false;
+    }
+    const int* coords = &m_bank_coords[static_cast<size_t>(flat_bank_id) * (m_bank_level + 1)];
+    for (int lvl = 1; lvl <= m_bank_level; lvl++) {
+      if (addr_vec[lvl] != -1 && addr_vec[lvl] != coords[lvl]) {
+        return false;
+      }
+    }
+    return true;
+  }
 
-  // Check if a bank node matches an addr_vec pattern (wildcards are -1)
-  static bool bank_matches(DRAMNode* bank, const AddrVec_t& addr_vec);
+  /// Visit the banks matching an addr_vec pattern in flat-id order, touching only those banks:
+  /// pinned levels select one child, wildcards fan out, and once nothing below is pinned the
+  /// node's banks are one contiguous block of flat ids. Same early-exit contract as below.
+  template <class Visitor>
+  bool for_each_bank_in_scope(const AddrVec_t& addr_vec, Visitor&& visitor) const {
+    if (addr_vec[0] != -1 && addr_vec[0] != m_root->m_node_id) {
+      return true;
+    }
+    int last_pinned = 0;
+    for (int lvl = 1; lvl <= m_bank_level; lvl++) {
+      if (addr_vec[lvl] != -1) {
+        last_pinned = lvl;
+      }
+    }
+    return visit_scope<0>(0, last_pinned, addr_vec, visitor);
+  }
 
   // Get indices into m_bank_nodes for the target banks of a command (cold-path wrapper)
   std::vector<int> get_target_banks(int command, const AddrVec_t& addr_vec) const;
@@ -66,21 +169,14 @@ class DRAMDevice {
         return visitor(get_flat_bank_id(addr_vec));
 
       case BankTarget::All:
-        for (int i = 0; i < static_cast<int>(m_bank_nodes.size()); ++i) {
-          if (!bank_matches(m_bank_nodes[i], addr_vec)) continue;
-          if (!visitor(i)) return false;
-        }
-        return true;
-
-      case BankTarget::SameBank: {
-        const int target_bank_id = addr_vec[m_bank_level];
-        for (int i = 0; i < static_cast<int>(m_bank_nodes.size()); ++i) {
-          if (m_bank_nodes[i]->m_node_id != target_bank_id) continue;
-          if (!bank_matches(m_bank_nodes[i], addr_vec)) continue;
-          if (!visitor(i)) return false;
+        return for_each_bank_in_scope(addr_vec, visitor);
+
+      case BankTarget::SameBank:
+        // The same bank id in every bank group (etc.) in scope; a wildcard bank id selects none
+        if (addr_vec[m_bank_level] < 0) {
+          return true;
         }
-        return true;
-      }
+        return for_each_bank_in_scope(addr_vec, visitor);
     }
     return true;
   }
@@ -95,6 +191,37 @@ class DRAMDevice {
   }
 
  private:
+  int m_bank_radix[AddrVec_t::capacity()] = {};  // level_sizes up to the bank level, kept inline for get_flat_bank_id
+  int m_banks_below[AddrVec_t::capacity()] = {};  // Banks under one node of each level (1 at the bank level)
+  std::vector<int> m_bank_coords;                 // [flat_bank_id][level] → node id of the bank's ancestor
+
+  std::vector<ILatencyOverride*> m_latency_overrides;
+  std::vector<int> m_reductions;  // Scratch for the overrides, [following cmd]
+
+  // The level is a template parameter so the recursion provably stays within AddrVec_t's capacity
+  template <int kLevel, class Visitor>
+  bool visit_scope(int flat_id, int last_pinned, const AddrVec_t& addr_vec, Visitor& visitor) const {
+    if (kLevel >= last_pinned) {
+      const int first = flat_id * m_banks_below[kLevel];
+      for (int i = first; i < first + m_banks_below[kLevel]; i++) {
+        if (!visitor(i)) return false;
+      }
+      return true;
+    }
+    if constexpr (kLevel + 1 < AddrVec_t::kCapacity) {
+      constexpr int kChild = kLevel + 1;
+      const int size = m_bank_radix[kChild];
+      const int id = addr_vec[kChild];
+      if (id != -1) {
+        return (id < 0 || id >= size) || visit_scope<kChild>(flat_id * size + id, last_pinned, addr_vec, visitor);
+      }
+      for (int i = 0; i < size; i++) {
+        if (!visit_scope<kChild>(flat_id * size + i, last_pinned, addr_vec, visitor)) return false;
+      }
+    }
+    return true;
+  }
+
   // Flat bank dispatch — apply action to target banks
   void apply_action(int command, const AddrVec_t& addr_vec, Clk_t clk);
 };
@@ -1,7 +1,41 @@
 #include "ramulator/dram/dram_spec.h"
 
+#include <mutex>
+
 namespace Ramulator {
 
+namespace {
+
+// Canonical, unambiguous encoding of a config subtree (maps are ordered, strings length-prefixed)
+void append_fingerprint(const ConfigNode& node, std::string& out) {
+  if (node.is_scalar()) {
+    const auto& s = node.scalar();
+    out += 's';
+    out += std::to_string(s.size());
+    out += ':';
+    out += s;
+  } else if (node.is_map()) {
+    out += '{';
+    for (const auto& [key, child] : node.map()) {
+      out += std::to_string(key.size());
+      out += ':';
+      out += key;
+      append_fingerprint(child, out);
+    }
+    out += '}';
+  } else if (node.is_sequence()) {
+    out += '[';
+    for (const auto& child : node.seq()) {
+      append_fingerprint(child, out);
+    }
+    out += ']';
+  } else {
+    out += '~';
+  }
+}
+
+}  // namespace
+
 void DRAMSpec::load_config(const ConfigNode& config) {
   const ConfigNode dram = config["dram"];
 
@@ -97,4 +131,26 @@ std::unique_ptr<DRAMSpec> DRAMSpec::create(const std::string& name, const Config
   return spec;
 }
 
+std::shared_ptr<const DRAMSpec> DRAMSpec::get_shared(const std::string& name, const ConfigNode& config) {
+  // Specs read nothing but config["dram"], so that subtree and the standard name identify one
+  std::string key = name;
+  key += '\0';
+  append_fingerprint(config["dram"], key);
+
+  static std::mutex mutex;
+  static std::map<std::string, std::weak_ptr<const DRAMSpec>> cache;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = cache.find(key);
+  if (it != cache.end()) {
+    if (auto spec = it->second.lock()) {
+      return spec;
+    }
+  }
+  // Only insert once create() has succeeded, and drop entries whose specs are gone
+  std::shared_ptr<const DRAMSpec> spec = create(name, config);
+  std::erase_if(cache, [](const auto& kv) { return kv.second.expired(); });
+  cache[std::move(key)] = spec;
+  return spec;
+}
+
 }  // namespace Ramulator
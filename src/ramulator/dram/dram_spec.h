@@ -173,6 +173,10 @@ struct DRAMSpec {
   static std::map<std::string, Creator>& registry();
   static bool register_standard(const std::string& name, Creator c);
   static std::unique_ptr<DRAMSpec> create(const std::string& name, const ConfigNode& config);
+
+  // Shared, read-only spec for (name, config["dram"]). Channels configured identically get the same
+  // instance, so the tables are built once; the cache keeps no spec alive once its users are gone.
+  static std::shared_ptr<const DRAMSpec> get_shared(const std::string& name, const ConfigNode& config);
 };
 
 }  // namespace Ramulator
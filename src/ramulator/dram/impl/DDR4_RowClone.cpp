@@ -0,0 +1,117 @@
+/******************************************************************************
+ * AUTO-GENERATED FILE — DO NOT EDIT
+ *
+ * Generated by: python -m ramulator codegen
+ * Source:       python/ramulator/dram/ddr4_rowclone.py
+ *
+ * Regenerate:   python -m ramulator codegen DDR4_RowClone
+ ******************************************************************************/
+#include "ramulator/dram/commands/ACT.h"
+#include "ramulator/dram/commands/PREab.h"
+#include "ramulator/dram/commands/PREpb.h"
+#include "ramulator/dram/commands/RCDST.h"
+#include "ramulator/dram/commands/RCFPM.h"
+#include "ramulator/dram/commands/RCSRC.h"
+#include "ramulator/dram/commands/RD.h"
+#include "ramulator/dram/commands/RDA.h"
+#include "ramulator/dram/commands/REFab.h"
+#include "ramulator/dram/commands/WR.h"
+#include "ramulator/dram/commands/WRA.h"
+#include "ramulator/dram/commands/populate.h"
+#include "ramulator/dram/dram_spec.h"
+
+namespace Ramulator {
+
+class DDR4_RowClone : public DRAMSpec {
+ public:
+  struct Level {
+    enum : int { Channel, Rank, BankGroup, Bank, Row, Column, COUNT };
+  };
+  struct Command {
+    enum : int { ACT, PREpb, PREab, RD, WR, RDA, WRA, REFab, RCFPM, RCSRC, RCDST, COUNT };
+  };
+  struct State {
+    enum : int { Opened, Closed, N_A, COUNT };
+  };
+  struct Timing {
+    enum : int {
+      rate,
+      nBL,
+      nCL,
+      nRCD,
+      nRP,
+      nRAS,
+      nRC,
+      nWR,
+      nRTP,
+      nCWL,
+      nCCDS,
+      nCCDL,
+      nRRDS,
+      nRRDL,
+      nWTRS,
+      nWTRL,
+      nFAW,
+      nRFC,
+      nREFI,
+      nCS,
+      tCK_ps,
+      nFPM,
+      nPSM,
+      COUNT
+    };
+  };
+
+  using CommandImpls =
+      std::tuple<Cmd::ACT<DDR4_RowClone>, Cmd::PREpb<DDR4_RowClone>, Cmd::PREab<DDR4_RowClone>,
+                 Cmd::RD<DDR4_RowClone>, Cmd::WR<DDR4_RowClone>, Cmd::RDA<DDR4_RowClone>, Cmd::WRA<DDR4_RowClone>,
+                 Cmd::REFab<DDR4_RowClone>, Cmd::RCFPM<DDR4_RowClone>, Cmd::RCSRC<DDR4_RowClone>,
+                 Cmd::RCDST<DDR4_RowClone> >;
+
+  DDR4_RowClone(const ConfigNode& config) {
+    // Counts
+    level_count = Level::COUNT;
+    command_count = Command::COUNT;
+    state_count = State::COUNT;
+    timing_count = Timing::COUNT;
+
+    // String name maps + reverse lookup vectors
+    set_names(levels, level_names, {"Channel", "Rank", "BankGroup", "Bank", "Row", "Column"});
+    set_names(commands, command_names,
+              {"ACT", "PREpb", "PREab", "RD", "WR", "RDA", "WRA", "REFab", "RCFPM", "RCSRC", "RCDST"});
+    set_names(states, state_names, {"Opened", "Closed", "N_A"});
+    set_names(timings, timing_names,
+              {"rate",  "nBL",   "nCL",   "nRCD",  "nRP",   "nRAS", "nRC",  "nWR",   "nRTP", "nCWL",   "nCCDS",
+               "nCCDL", "nRRDS", "nRRDL", "nWTRS", "nWTRL", "nFAW", "nRFC", "nREFI", "nCS",  "tCK_ps", "nFPM",
+               "nPSM"});
+
+    // Static spec data
+    internal_prefetch_size = 8;
+    init_states = {
+        State::N_A,     // Channel
+        State::N_A,     // Rank
+        State::N_A,     // BankGroup
+        State::Closed,  // Bank
+        State::Closed,  // Row
+        State::N_A,     // Column
+    };
+    supported_requests = {
+        Command::RD,     // Read -> RD
+        Command::WR,     // Write -> WR
+        Command::RCFPM,  // Copy -> RCFPM
+        Command::RCFPM,  // Init -> RCFPM
+    };
+
+    // Runtime config (organization, timing values, timing constraints)
+    load_config(config);
+
+    // Command handlers (function pointers, metadata, bank targets)
+    populate_commands(CommandImpls{}, *this);
+  }
+};
+
+// Self-registration
+static bool _dram_ddr4_rowclone = DRAMSpec::register_standard(
+    "DDR4_RowClone", [](const ConfigNode& config) { return std::make_unique<DDR4_RowClone>(config); });
+
+}  // namespace Ramulator
@@ -0,0 +1,110 @@
+/******************************************************************************
+ * AUTO-GENERATED FILE — DO NOT EDIT
+ *
+ * Generated by: python -m ramulator codegen
+ * Source:       python/ramulator/dram/ddr4_salp.py
+ *
+ * Regenerate:   python -m ramulator codegen DDR4_SALP
+ ******************************************************************************/
+#include "ramulator/dram/commands/ACT.h"
+#include "ramulator/dram/commands/PREab.h"
+#include "ramulator/dram/commands/PREpb.h"
+#include "ramulator/dram/commands/RD.h"
+#include "ramulator/dram/commands/RDA.h"
+#include "ramulator/dram/commands/REFab.h"
+#include "ramulator/dram/commands/SASEL.h"
+#include "ramulator/dram/commands/WR.h"
+#include "ramulator/dram/commands/WRA.h"
+#include "ramulator/dram/commands/populate.h"
+#include "ramulator/dram/dram_spec.h"
+
+namespace Ramulator {
+
+class DDR4_SALP : public DRAMSpec {
+ public:
+  struct Level {
+    enum : int { Channel, Rank, BankGroup, Bank, Subarray, Row, Column, COUNT };
+  };
+  struct Command {
+    enum : int { ACT, PREpb, PREab, RD, WR, RDA, WRA, REFab, SASEL, COUNT };
+  };
+  struct State {
+    enum : int { Opened, Closed, N_A, Selected, COUNT };
+  };
+  struct Timing {
+    enum : int {
+      rate,
+      nBL,
+      nCL,
+      nRCD,
+      nRP,
+      nRAS,
+      nRC,
+      nWR,
+      nRTP,
+      nCWL,
+      nCCDS,
+      nCCDL,
+      nRRDS,
+      nRRDL,
+      nWTRS,
+      nWTRL,
+      nFAW,
+      nRFC,
+      nREFI,
+      nCS,
+      tCK_ps,
+      nSCD,
+      COUNT
+    };
+  };
+
+  using CommandImpls =
+      std::tuple<Cmd::ACT<DDR4_SALP>, Cmd::PREpb<DDR4_SALP>, Cmd::PREab<DDR4_SALP>, Cmd::RD<DDR4_SALP>,
+                 Cmd::WR<DDR4_SALP>, Cmd::RDA<DDR4_SALP>, Cmd::WRA<DDR4_SALP>, Cmd::REFab<DDR4_SALP>,
+                 Cmd::SASEL<DDR4_SALP> >;
+
+  DDR4_SALP(const ConfigNode& config) {
+    // Counts
+    level_count = Level::COUNT;
+    command_count = Command::COUNT;
+    state_count = State::COUNT;
+    timing_count = Timing::COUNT;
+
+    // String name maps + reverse lookup vectors
+    set_names(levels, level_names, {"Channel", "Rank", "BankGroup", "Bank", "Subarray", "Row", "Column"});
+    set_names(commands, command_names, {"ACT", "PREpb", "PREab", "RD", "WR", "RDA", "WRA", "REFab", "SASEL"});
+    set_names(states, state_names, {"Opened", "Closed", "N_A", "Selected"});
+    set_names(timings, timing_names,
+              {"rate",  "nBL",   "nCL",   "nRCD",  "nRP",   "nRAS", "nRC",  "nWR",   "nRTP", "nCWL",   "nCCDS",
+               "nCCDL", "nRRDS", "nRRDL", "nWTRS", "nWTRL", "nFAW", "nRFC", "nREFI", "nCS",  "tCK_ps", "nSCD"});
+
+    // Static spec data
+    internal_prefetch_size = 8;
+    init_states = {
+        State::N_A,     // Channel
+        State::N_A,     // Rank
+        State::N_A,     // BankGroup
+        State::Closed,  // Bank
+        State::Closed,  // Subarray
+        State::Closed,  // Row
+        State::N_A,     // Column
+    };
+    supported_requests = {
+        Command::RD,  // Read -> RD
+        Command::WR,  // Write -> WR
+    };
+
+    // Runtime config (organization, timing values, timing constraints)
+    load_config(config);
+
+    // Command handlers (function pointers, metadata, bank targets)
+    populate_commands(CommandImpls{}, *this);
+  }
+};
+
+// Self-registration
+static bool _dram_ddr4_salp = DRAMSpec::register_standard(
+    "DDR4_SALP", [](const ConfigNode& config) { return std::make_unique<DDR4_SALP>(config); });
+
+}  // namespace Ramulator
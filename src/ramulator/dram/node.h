@@ -1,9 +1,9 @@
 #ifndef RAMULATOR_DRAM_NODE_H
 #define RAMULATOR_DRAM_NODE_H
 
-#include <deque>
+#include <algorithm>
+#include <cstdint>
 #include <memory>
-#include <unordered_map>
 #include <vector>
 
 #include "ramulator/base/type.h"
@@ -11,35 +11,85 @@
 
 namespace Ramulator {
 
+/**
+ * @brief     Open rows of one bank
+ *
+ * A bank normally has at most one open row, so the rows are kept in a small
+ * inline array scanned linearly, so the usual lookup is a single compare. Rows
+ * past the inline capacity (standards or plugins that keep several rows open)
+ * spill into a vector instead of being dropped.
+ */
+class OpenRows {
+ public:
+  static constexpr int kInlineRows = 4;
+
+  bool contains(int row) const {
+    for (int i = 0; i < m_count; i++) {
+      if (m_rows[i] == row) {
+        return true;
+      }
+    }
+    return !m_spill.empty() && std::find(m_spill.begin(), m_spill.end(), row) != m_spill.end();
+  }
+  void insert(int row) {
+    if (contains(row)) {
+      return;
+    }
+    if (m_count < kInlineRows) {
+      m_rows[m_count++] = row;
+    } else {
+      m_spill.push_back(row);
+    }
+  }
+  void clear() {
+    m_count = 0;
+    m_spill.clear();
+  }
+  int size() const {
+    return m_count + static_cast<int>(m_spill.size());
+  }
+
+ private:
+  int m_rows[kInlineRows] = {};
+  uint8_t m_count = 0;
+  std::vector<int> m_spill;  // Rows beyond kInlineRows; filled only once the inline array is full
+};
+
 /**
  * @brief     DRAM Device Node — represents one level in the DRAM hierarchy
  *
- * DRAMNode holds per-node state (m_state, m_row_state, timing history).
+ * DRAMNode holds per-node state (m_state, m_open_rows).
  * All spec metadata is accessed through DRAMSpec (runtime, non-templated).
  *
  * State operations (action, preq, rowhit, rowopen) are dispatched by the
- * controller via a flat bank array — only timing uses the hierarchy.
+ * controller via a flat bank array. Timing state is not kept per node; it
+ * lives in the device's flat DRAMTimingState.
  */
 struct DRAMNode {
   DRAMNode* m_parent_node = nullptr;  // Non-owning back-reference
   std::vector<std::unique_ptr<DRAMNode>> m_child_nodes;
 
-  DRAMSpec* m_spec = nullptr;
+  const DRAMSpec* m_spec = nullptr;
 
   int m_level = -1;    // The level of this node in the organization hierarchy
   int m_node_id = -1;  // The id of this node at this level
 
   int m_state = -1;  // The state of the node
 
-  std::vector<Clk_t> m_cmd_ready_clk;            // The next cycle that each command can be issued again at this level
-  std::vector<std::deque<Clk_t>> m_cmd_history;  // Issue-history of each command at this level
-
-  std::unordered_map<int, int> m_row_state;  // The state of the rows, if I am a bank-ish node
+  OpenRows m_open_rows;  // The open rows, if I am a bank-ish node
 
-  DRAMNode(DRAMSpec* spec, DRAMNode* parent, int level, int id);
+  DRAMNode(const DRAMSpec* spec, DRAMNode* parent, int level, int id);
 
-  void update_timing(int command, const AddrVec_t& addr_vec, Clk_t clk);
-  bool check_timing(int command, const AddrVec_t& addr_vec, Clk_t clk);
+  // Row state accessors used by the command templates
+  bool is_row_open(int row) const {
+    return m_open_rows.contains(row);
+  }
+  void open_row(int row) {
+    m_open_rows.insert(row);
+  }
+  void close_rows() {
+    m_open_rows.clear();
+  }
 
   // Generic level traversal — visit all descendants at target_level
   template <typename Func>
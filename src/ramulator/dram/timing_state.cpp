@@ -0,0 +1,361 @@
+#include "ramulator/dram/timing_state.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define RAMULATOR_TIMING_AVX2 1
+#endif
+
+namespace Ramulator {
+
+namespace {
+
+// Bit i of ready_mask: ready_clk[paths[banks[i]][l] + commands[i]] <= clk at every level l.
+void check_paths_scalar(const Clk_t* ready_clk, const int* paths, int num_levels, const int* commands,
+                        const int* banks, int first, int n, Clk_t clk, uint64_t* ready_mask) {
+  for (int i = first; i < n; i++) {
+    const int* path = paths + static_cast<size_t>(banks[i]) * num_levels;
+    bool ready = true;
+    for (int l = 0; l < num_levels && ready; l++) {
+      ready = clk >= ready_clk[path[l] + commands[i]];
+    }
+    if (ready) {
+      ready_mask[i / 64] |= uint64_t(1) << (i % 64);
+    }
+  }
+}
+
+#ifdef RAMULATOR_TIMING_AVX2
+// Four requests per step: gather each level's offsets, then the ready clocks, and compare.
+__attribute__((target("avx2"))) int check_paths_avx2(const Clk_t* ready_clk, const int* paths, int num_levels,
+                                                     const int* commands, const int* banks, int n, Clk_t clk,
+                                                     uint64_t* ready_mask) {
+  const __m256i clk_v = _mm256_set1_epi64x(clk);
+  const __m128i levels_v = _mm_set1_epi32(num_levels);
+  int i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i path_v = _mm_mullo_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(banks + i)), levels_v);
+    __m128i cmd_v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(commands + i));
+    __m256i late = _mm256_setzero_si256();
+    for (int l = 0; l < num_levels; l++) {
+      __m128i offset = _mm_add_epi32(_mm_i32gather_epi32(paths + l, path_v, 4), cmd_v);
+      __m256i ready = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(ready_clk), offset, 8);
+      late = _mm256_or_si256(late, _mm256_cmpgt_epi64(ready, clk_v));
+    }
+    uint64_t bits = ~static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(late))) & 0xFu;
+    ready_mask[i / 64] |= bits << (i % 64);
+  }
+  return i;
+}
+#endif
+
+}  // namespace
+
+void DRAMTimingState::init(const DRAMSpec* spec, int num_levels, bool lazy_leaves) {
+  m_spec = spec;
+  m_num_levels = num_levels;
+  m_num_cmds = spec->command_count;
+  m_lazy = lazy_leaves;
+  const int eager_levels = m_lazy ? num_levels - 1 : num_levels;
+
+  m_level_sizes.assign(num_levels, 1);
+  for (int level = 1; level < num_levels; level++) {
+    m_level_sizes[level] = spec->organization.level_sizes[level];
+  }
+
+  // Ready clocks: one [flat_node_id][cmd] slab per eager level
+  m_ready_offsets.assign(num_levels, 0);
+  size_t num_nodes = 1;
+  size_t total = 0;
+  for (int level = 0; level < eager_levels; level++) {
+    num_nodes *= m_level_sizes[level];
+    m_ready_offsets[level] = total;
+    total += num_nodes * m_num_cmds;
+  }
+  m_ready_clk.assign(total, -1);
+
+  // Constraints and issue histories per (level, cmd): the target constraints followed by the
+  // sibling ones, and one [flat_node_id][window] ring block (plus a head index per node).
+  // Lazy leaves lay out their rings inside their own block instead, after the ready clocks.
+  m_cons.clear();
+  m_blocks.assign(static_cast<size_t>(num_levels) * m_num_cmds, ConsBlock{});
+  num_nodes = 1;
+  total = 0;
+  size_t total_heads = 0;
+  m_leaf_clks = m_num_cmds;
+  m_leaf_heads = 0;
+  for (int level = 0; level < num_levels; level++) {
+    num_nodes *= m_level_sizes[level];
+    const bool lazy_level = level >= eager_levels;
+    for (int cmd = 0; cmd < m_num_cmds; cmd++) {
+      const auto& cons = spec->timing_cons[level][cmd];
+      ConsBlock& b = m_blocks[static_cast<size_t>(level) * m_num_cmds + cmd];
+      b.first = static_cast<int>(m_cons.size());
+      for (const auto& t : cons) {
+        if (!t.sibling) {
+          m_cons.push_back({t.cmd, t.val, t.window - 1});
+          b.num_target++;
+          b.window = std::max(b.window, t.window);
+        }
+      }
+      for (const auto& t : cons) {
+        if (t.sibling) {
+          m_cons.push_back({t.cmd, t.val, 0});
+          b.num_sibling++;
+        }
+      }
+      if (lazy_level) {
+        b.history_offset = m_leaf_clks;
+        m_leaf_clks += b.window;
+        b.head_offset = m_leaf_heads;
+        m_leaf_heads += (b.window > 0) ? 1 : 0;
+      } else {
+        b.history_offset = total;
+        total += num_nodes * b.window;
+        b.head_offset = total_heads;
+        total_heads += (b.window > 0) ? num_nodes : 0;
+      }
+    }
+  }
+  m_history.assign(total, -1);
+  m_history_heads.assign(total_heads, 0);
+  m_num_leaves = num_nodes;
+  m_leaf_blocks.clear();
+  m_leaf_blocks.resize(m_lazy ? num_nodes : 0);
+  m_num_touched_leaves = 0;
+
+  init_bank_paths();
+
+  switch (num_levels) {
+    case 1: bind_walkers<1>(); break;
+    case 2: bind_walkers<2>(); break;
+    case 3: bind_walkers<3>(); break;
+    case 4: bind_walkers<4>(); break;
+    case 5: bind_walkers<5>(); break;
+    case 6: bind_walkers<6>(); break;
+    default:
+      throw std::runtime_error("DRAMTimingState: " + std::to_string(num_levels) +
+                               " timing levels exceed the supported " + std::to_string(kMaxLevels));
+  }
+}
+
+void DRAMTimingState::init_bank_paths() {
+  m_bank_paths.clear();
+  // Batching needs the bank to be the deepest (eager) timing level and offsets that fit the gathers
+  if (m_lazy || m_num_levels != m_spec->get_level_id("Bank") + 1 ||
+      m_ready_clk.size() > static_cast<size_t>(std::numeric_limits<int>::max())) {
+    return;
+  }
+  int bank_level = m_num_levels - 1;
+  int num_banks = 1;
+  for (int level = 1; level <= bank_level; level++) {
+    num_banks *= m_level_sizes[level];
+  }
+  m_bank_paths.resize(static_cast<size_t>(num_banks) * m_num_levels);
+  for (int bank = 0; bank < num_banks; bank++) {
+    int flat_id = bank;
+    for (int level = bank_level; level >= 0; level--) {
+      m_bank_paths[static_cast<size_t>(bank) * m_num_levels + level] =
+          static_cast<int>(m_ready_offsets[level] + static_cast<size_t>(flat_id) * m_num_cmds);
+      flat_id /= m_level_sizes[level];
+    }
+  }
+#ifdef RAMULATOR_TIMING_AVX2
+  m_use_avx2 = __builtin_cpu_supports("avx2");
+#endif
+}
+
+void DRAMTimingState::check_timing_batch(const int* commands, const int* flat_bank_ids, int n, Clk_t clk,
+                                         uint64_t* ready_mask) const {
+  std::fill(ready_mask, ready_mask + (n + 63) / 64, 0);
+  int first = 0;
+#ifdef RAMULATOR_TIMING_AVX2
+  if (m_use_avx2) {
+    first = check_paths_avx2(m_ready_clk.data(), m_bank_paths.data(), m_num_levels, commands, flat_bank_ids, n, clk,
+                             ready_mask);
+  }
+#endif
+  check_paths_scalar(m_ready_clk.data(), m_bank_paths.data(), m_num_levels, commands, flat_bank_ids, first, n, clk,
+                     ready_mask);
+}
+
+template <int kLevels>
+void DRAMTimingState::bind_walkers() {
+  if (m_lazy) {
+    m_update = &DRAMTimingState::update_root<kLevels, true>;
+    m_check = &DRAMTimingState::check_root<kLevels, true>;
+    m_ready = &DRAMTimingState::ready_root<kLevels, true>;
+  } else {
+    m_update = &DRAMTimingState::update_root<kLevels, false>;
+    m_check = &DRAMTimingState::check_root<kLevels, false>;
+    m_ready = &DRAMTimingState::ready_root<kLevels, false>;
+  }
+}
+
+DRAMTimingState::LeafBlock& DRAMTimingState::touch_leaf(int flat_id) {
+  LeafBlock& leaf = m_leaf_blocks[flat_id];
+  if (!leaf.clks) {
+    leaf.clks = std::make_unique<Clk_t[]>(m_leaf_clks);
+    std::fill(leaf.clks.get(), leaf.clks.get() + m_leaf_clks, -1);
+    leaf.heads = std::make_unique<int[]>(m_leaf_heads);
+    m_num_touched_leaves++;
+  }
+  return leaf;
+}
+
+template <int kLevels, bool kLazy>
+void DRAMTimingState::update_root(int command, const AddrVec_t& addr_vec, Clk_t clk) {
+  update_node<kLevels, kLazy, 0>(0, m_channel_id, command, addr_vec, clk);
+}
+
+template <int kLevels, bool kLazy>
+bool DRAMTimingState::check_root(int command, const AddrVec_t& addr_vec, Clk_t clk) const {
+  return check_from<kLevels, kLazy, 0>(0, command, addr_vec, clk);
+}
+
+template <int kLevels, bool kLazy>
+Clk_t DRAMTimingState::ready_root(int command, const AddrVec_t& addr_vec) const {
+  return ready_clk_from<kLevels, kLazy, 0>(0, command, addr_vec);
+}
+
+template <int kLevels, bool kLazy, int kLevel>
+Clk_t DRAMTimingState::node_ready_clk(int flat_id, int command) const {
+  if constexpr (kLazy && kLevel == kLevels - 1) {
+    // An untouched leaf has never been constrained
+    const LeafBlock& leaf = m_leaf_blocks[flat_id];
+    return leaf.clks ? leaf.clks[command] : -1;
+  } else {
+    return ready_clk(kLevel, flat_id, command);
+  }
+}
+
+template <int kLevels, bool kLazy, int kLevel>
+void DRAMTimingState::update_node(int flat_id, int node_id, int command, const AddrVec_t& addr_vec, Clk_t clk) {
+  const ConsBlock& b = block(kLevel, command);
+  const Constraint* cons = m_cons.data() + b.first;
+
+  bool is_sibling = node_id != addr_vec[kLevel] && addr_vec[kLevel] != -1;
+
+  // Ready clocks of this node, indexed by command
+  Clk_t* ready_clks;
+  LeafBlock* leaf = nullptr;
+  if constexpr (kLazy && kLevel == kLevels - 1) {
+    // Only allocate a leaf once a constraint is written to it, so wildcard commands
+    // and sibling walks leave unconstrained leaves untouched
+    if (is_sibling ? b.num_sibling == 0 : b.window == 0) {
+      return;
+    }
+    leaf = &touch_leaf(flat_id);
+    ready_clks = leaf->clks.get();
+  } else {
+    ready_clks = &ready_clk(kLevel, flat_id, 0);
+  }
+
+  // Sibling of the target node: only sibling constraints apply, nothing below is touched
+  if (is_sibling) {
+    for (int i = b.num_target; i < b.num_target + b.num_sibling; i++) {
+      Clk_t& ready = ready_clks[cons[i].cmd];
+      ready = std::max(ready, clk + cons[i].val);
+    }
+    return;
+  }
+
+  // Target node: record the issue, then apply constraints against the history
+  if (b.window > 0) {
+    // Ring buffer, newest entry at head; the (n+1)-th most recent issue is at head + n
+    Clk_t* history;
+    int* head;
+    if constexpr (kLazy && kLevel == kLevels - 1) {
+      history = leaf->clks.get() + b.history_offset;
+      head = leaf->heads.get() + b.head_offset;
+    } else {
+      history = &m_history[b.history_offset + static_cast<size_t>(flat_id) * b.window];
+      head = &m_history_heads[b.head_offset + flat_id];
+    }
+    *head = (*head == 0) ? b.window - 1 : *head - 1;
+    history[*head] = clk;
+
+    for (int i = 0; i < b.num_target; i++) {
+      int pos = *head + cons[i].pos;
+      if (pos >= b.window) {
+        pos -= b.window;
+      }
+      Clk_t past = history[pos];
+      if (past < 0) {
+        continue;
+      }
+      Clk_t val = cons[i].val;
+      if constexpr (kLevel == kLevels - 1) {
+        if (m_reductions && cons[i].pos == 0) {
+          val -= m_reductions[cons[i].cmd];
+        }
+      }
+      Clk_t& ready = ready_clks[cons[i].cmd];
+      ready = std::max(ready, past + val);
+    }
+  }
+
+  if constexpr (kLevel + 1 < kLevels) {
+    constexpr int kChild = kLevel + 1;
+    // Skip traversal that does not have sibling timing constraints
+    int child_size = m_level_sizes[kChild];
+    int target_child_id = addr_vec[kChild];
+    if (block(kChild, command).num_sibling > 0 || target_child_id == -1) {
+      for (int i = 0; i < child_size; i++) {
+        update_node<kLevels, kLazy, kChild>(flat_id * child_size + i, i, command, addr_vec, clk);
+      }
+    } else {
+      update_node<kLevels, kLazy, kChild>(flat_id * child_size + target_child_id, target_child_id, command, addr_vec,
+                                          clk);
+    }
+  }
+}
+
+template <int kLevels, bool kLazy, int kLevel>
+bool DRAMTimingState::check_from(int flat_id, int command, const AddrVec_t& addr_vec, Clk_t clk) const {
+  if (clk < node_ready_clk<kLevels, kLazy, kLevel>(flat_id, command)) {
+    return false;
+  }
+  if constexpr (kLevel + 1 < kLevels) {
+    // Straight walk down the addressed path; only a wildcard level fans out.
+    constexpr int kChild = kLevel + 1;
+    int child_size = m_level_sizes[kChild];
+    int child_id = addr_vec[kChild];
+    if (child_id == -1) {
+      for (int i = 0; i < child_size; i++) {
+        if (!check_from<kLevels, kLazy, kChild>(flat_id * child_size + i, command, addr_vec, clk)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    return check_from<kLevels, kLazy, kChild>(flat_id * child_size + child_id, command, addr_vec, clk);
+  } else {
+    return true;
+  }
+}
+
+template <int kLevels, bool kLazy, int kLevel>
+Clk_t DRAMTimingState::ready_clk_from(int flat_id, int command, const AddrVec_t& addr_vec) const {
+  Clk_t ready = node_ready_clk<kLevels, kLazy, kLevel>(flat_id, command);
+  if constexpr (kLevel + 1 < kLevels) {
+    constexpr int kChild = kLevel + 1;
+    int child_size = m_level_sizes[kChild];
+    int child_id = addr_vec[kChild];
+    if (child_id == -1) {
+      for (int i = 0; i < child_size; i++) {
+        ready = std::max(ready, ready_clk_from<kLevels, kLazy, kChild>(flat_id * child_size + i, command, addr_vec));
+      }
+      return ready;
+    }
+    return std::max(ready, ready_clk_from<kLevels, kLazy, kChild>(flat_id * child_size + child_id, command, addr_vec));
+  } else {
+    return ready;
+  }
+}
+
+}  // namespace Ramulator
@@ -0,0 +1,173 @@
+#ifndef RAMULATOR_DRAM_TIMING_STATE_H
+#define RAMULATOR_DRAM_TIMING_STATE_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ramulator/base/type.h"
+#include "ramulator/dram/dram_spec.h"
+
+namespace Ramulator {
+
+/**
+ * @brief     Timing state of one DRAM device, stored as flat arrays
+ *
+ * Every node of the organization hierarchy (Channel down to Bank, or whichever
+ * level is last above Row) is identified by (level, flat_node_id), where
+ *   flat_node_id(level) = flat_node_id(level - 1) * level_size[level] + addr_vec[level]
+ * and the root (Channel) has flat id 0. Ready clocks are kept in one contiguous
+ * [level][flat_node_id][cmd] array and issue histories in per-(level, cmd) blocks of
+ * fixed-size rings (window = the longest constraint window of that command), so
+ * checking a command walks the root-to-bank path with a few indexed loads and
+ * recording an issue is a single store.
+ *
+ * At init the spec's nested timing_cons are compiled into one flat constraint
+ * table (per (level, cmd): target constraints, then sibling constraints), and the
+ * walkers are instantiated per hierarchy depth, so each level of the walk is
+ * straight-line code instead of a generic level loop.
+ *
+ * When the timing hierarchy ends at the Bank level, every bank's root-to-bank path
+ * is also precomputed as a row of m_ready_clk offsets, so single-bank commands of a
+ * whole request buffer can be checked in one batch (gathers and vector compares on
+ * AVX2 hosts, a plain loop elsewhere).
+ *
+ * With lazy leaves, only the levels above the deepest one are allocated up front.
+ * Each node of the deepest level (Bank, or e.g. Subarray) gets its own block of
+ * ready clocks and history rings on the first command that constrains it; until
+ * then it reads as never constrained. This keeps large multi-rank organizations
+ * cheap when most banks stay idle, at the cost of one indirection per leaf and no
+ * batched checks.
+ *
+ * Semantics are identical to the per-node tree: sibling constraints apply to the
+ * non-target nodes of a level, wildcards (-1) in addr_vec select all children.
+ */
+class DRAMTimingState {
+ public:
+  // Deepest hierarchy the walkers are instantiated for
+  static constexpr int kMaxLevels = 6;
+
+  void init(const DRAMSpec* spec, int num_levels, bool lazy_leaves = false);
+  void set_channel_id(int channel_id) {
+    m_channel_id = channel_id;
+  }
+
+  // reductions (optional, [following cmd]): cycles taken off the deepest level's constraints
+  // that count from this issue, for rows that are faster than nominal (e.g., ChargeCache)
+  void update_timing(int command, const AddrVec_t& addr_vec, Clk_t clk, const int* reductions = nullptr) {
+    m_reductions = reductions;
+    (this->*m_update)(command, addr_vec, clk);
+  }
+  bool check_timing(int command, const AddrVec_t& addr_vec, Clk_t clk) const {
+    return (this->*m_check)(command, addr_vec, clk);
+  }
+  // Earliest cycle at which check_timing() passes (-1 if unconstrained)
+  Clk_t get_ready_clk(int command, const AddrVec_t& addr_vec) const {
+    return (this->*m_ready)(command, addr_vec);
+  }
+
+  // Batched check_timing() of single-bank commands given by flat bank id; see DRAMDevice::check_timing_batch()
+  bool supports_batch() const {
+    return !m_bank_paths.empty();
+  }
+  void check_timing_batch(const int* commands, const int* flat_bank_ids, int n, Clk_t clk, uint64_t* ready_mask) const;
+
+  int get_num_levels() const {
+    return m_num_levels;
+  }
+  // Deepest-level nodes holding timing state (all of them unless lazy)
+  size_t get_num_allocated_leaves() const {
+    return m_lazy ? m_num_touched_leaves : m_num_leaves;
+  }
+
+ private:
+  // One compiled timing constraint
+  struct Constraint {
+    int cmd;  // Constrained command
+    int val;  // Cycles
+    int pos;  // Target constraints: ring offset of the issue it counts from (window - 1)
+  };
+
+  // Compiled constraints and history layout of one (level, cmd)
+  struct ConsBlock {
+    int first = 0;        // Index into m_cons; target constraints first
+    int num_target = 0;
+    int num_sibling = 0;  // Sibling constraints follow the target ones
+    int window = 0;       // History ring length (0 if untracked)
+    size_t history_offset = 0;  // Start of its [flat_node_id][window] block in m_history (lazy leaf: in the block)
+    size_t head_offset = 0;     // Start of its [flat_node_id] block in m_history_heads (lazy leaf: in the block)
+  };
+
+  const DRAMSpec* m_spec = nullptr;
+  int m_num_levels = 0;    // Levels that hold timing state (Channel .. last level above Row)
+  int m_num_cmds = 0;
+  int m_channel_id = 0;    // Node id of the root, compared against addr_vec[0] on update
+
+  std::vector<int> m_level_sizes;       // Children per parent at each level
+  std::vector<size_t> m_ready_offsets;  // Start of each level in m_ready_clk
+  std::vector<Clk_t> m_ready_clk;       // [level][flat_node_id][cmd]
+
+  std::vector<Constraint> m_cons;   // All constraints, grouped per (level, cmd)
+  std::vector<ConsBlock> m_blocks;  // [level][cmd]
+  std::vector<Clk_t> m_history;      // Ring per (level, cmd, node), -1 if never issued
+  std::vector<int> m_history_heads;  // Ring index of the most recent issue
+
+  // Lazy leaves: per-node blocks of the deepest level, allocated by touch_leaf()
+  struct LeafBlock {
+    std::unique_ptr<Clk_t[]> clks;  // Ready clocks [cmd], then the history rings (ConsBlock::history_offset)
+    std::unique_ptr<int[]> heads;   // Ring heads (ConsBlock::head_offset)
+  };
+  bool m_lazy = false;
+  size_t m_num_leaves = 0;
+  size_t m_num_touched_leaves = 0;
+  int m_leaf_clks = 0;   // Clk_t entries per leaf block
+  int m_leaf_heads = 0;  // Ring heads per leaf block
+  std::vector<LeafBlock> m_leaf_blocks;
+
+  const int* m_reductions = nullptr;  // Of the update in progress
+
+  std::vector<int> m_bank_paths;  // [flat_bank_id][level] → m_ready_clk offset of the bank's ancestor at level
+  bool m_use_avx2 = false;
+
+  // Walkers for the configured depth, bound in init()
+  void (DRAMTimingState::*m_update)(int, const AddrVec_t&, Clk_t) = nullptr;
+  bool (DRAMTimingState::*m_check)(int, const AddrVec_t&, Clk_t) const = nullptr;
+  Clk_t (DRAMTimingState::*m_ready)(int, const AddrVec_t&) const = nullptr;
+
+  Clk_t& ready_clk(int level, int flat_id, int command) {
+    return m_ready_clk[m_ready_offsets[level] + static_cast<size_t>(flat_id) * m_num_cmds + command];
+  }
+  Clk_t ready_clk(int level, int flat_id, int command) const {
+    return m_ready_clk[m_ready_offsets[level] + static_cast<size_t>(flat_id) * m_num_cmds + command];
+  }
+
+  const ConsBlock& block(int level, int command) const {
+    return m_blocks[static_cast<size_t>(level) * m_num_cmds + command];
+  }
+
+  void init_bank_paths();
+
+  template <int kLevels>
+  void bind_walkers();
+  LeafBlock& touch_leaf(int flat_id);
+
+  template <int kLevels, bool kLazy>
+  void update_root(int command, const AddrVec_t& addr_vec, Clk_t clk);
+  template <int kLevels, bool kLazy>
+  bool check_root(int command, const AddrVec_t& addr_vec, Clk_t clk) const;
+  template <int kLevels, bool kLazy>
+  Clk_t ready_root(int command, const AddrVec_t& addr_vec) const;
+
+  template <int kLevels, bool kLazy, int kLevel>
+  Clk_t node_ready_clk(int flat_id, int command) const;
+  template <int kLevels, bool kLazy, int kLevel>
+  void update_node(int flat_id, int node_id, int command, const AddrVec_t& addr_vec, Clk_t clk);
+  template <int kLevels, bool kLazy, int kLevel>
+  bool check_from(int flat_id, int command, const AddrVec_t& addr_vec, Clk_t clk) const;
+  template <int kLevels, bool kLazy, int kLevel>
+  Clk_t ready_clk_from(int flat_id, int command, const AddrVec_t& addr_vec) const;
+};
+
+}  // namespace Ramulator
+
+#endif  // RAMULATOR_DRAM_TIMING_STATE_H
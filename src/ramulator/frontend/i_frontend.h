@@ -34,6 +34,15 @@ class IFrontEnd : public TopLevel<IFrontEnd> {
   virtual void tick() = 0;
   virtual bool is_finished() = 0;
 
+  // Idle fast-forward: queried right after tick(), returns how many upcoming tick() calls are
+  // known to be no-ops as long as the memory system does not change state meanwhile
+  // (CLK_NEVER if the frontend is stalled until then). The defaults disable skipping.
+  virtual Clk_t get_num_idle_ticks() {
+    return 0;
+  }
+  virtual void skip_idle_ticks(Clk_t num_ticks) {
+  }
+
   void finalize() {
     m_impl->finalize();
     for (auto component : m_components) {
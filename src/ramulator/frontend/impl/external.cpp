@@ -1,3 +1,7 @@
+#include <functional>
+#include <utility>
+#include <vector>
+
 #include "ramulator/base/param.h"
 #include "ramulator/frontend/i_frontend.h"
 
@@ -18,9 +22,49 @@ class ExternalFrontEnd : public IFrontEnd, public Implementation {
   bool receive_external_requests(int req_type_id, Addr_t addr, int source_id,
                                  std::function<void(Request&)> callback,
                                  int size_bytes) override {
-    Request req(addr, req_type_id, source_id, std::move(callback));
+    Request req(addr, req_type_id, source_id, nullptr);
     req.size_bytes = size_bytes;
-    return m_memory_system->send(req);
+    if (!callback) {
+      return m_memory_system->send(req);
+    }
+
+    // The external callback owns state, so it stays here and the request only carries its slot.
+    int slot = acquire_callback_slot(std::move(callback));
+    req.callback = [this, slot](Request& completed) { invoke_callback_slot(slot, completed); };
+    if (!m_memory_system->send(req)) {
+      release_callback_slot(slot);
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  std::vector<std::function<void(Request&)>> m_callbacks;  // Indexed by slot
+  std::vector<int> m_free_slots;
+
+  int acquire_callback_slot(std::function<void(Request&)> callback) {
+    int slot;
+    if (m_free_slots.empty()) {
+      slot = static_cast<int>(m_callbacks.size());
+      m_callbacks.emplace_back();
+    } else {
+      slot = m_free_slots.back();
+      m_free_slots.pop_back();
+    }
+    m_callbacks[slot] = std::move(callback);
+    return slot;
+  }
+
+  void release_callback_slot(int slot) {
+    m_callbacks[slot] = nullptr;
+    m_free_slots.push_back(slot);
+  }
+
+  void invoke_callback_slot(int slot, Request& req) {
+    // Free the slot first: the callback may send a new request that reuses it.
+    auto callback = std::move(m_callbacks[slot]);
+    release_callback_slot(slot);
+    callback(req);
   }
 };
 
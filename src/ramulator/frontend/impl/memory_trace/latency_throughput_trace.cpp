@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <fmt/format.h>
 #include <optional>
 #include <random>
@@ -170,6 +171,53 @@ class LatencyThroughputTrace : public IFrontEnd, public Implementation {
     return s_latency_samples_completed >= m_latency_sample_count;
   }
 
+  // While no request can go out, the NOP/probe alternation only depends on (m_curr_nop,
+  // m_issue_probe), so idle stretches until the next stream or probe turn have a closed form.
+  Clk_t get_num_idle_ticks() override {
+    if (m_streaming_only) {
+      return m_retry_stream_req ? CLK_NEVER : 0;
+    }
+
+    bool is_nop_turn = m_nop_counter > 1 && m_curr_nop != 0;
+    Clk_t num_idle = 0;
+    if (m_latency_measure_mode == LatencyMeasureMode::StreamOnly) {
+      num_idle = is_nop_turn ? m_nop_counter - m_curr_nop : 0;
+    } else {
+      bool probe_blocked = m_probe_inflight || !wants_probe();
+      if (m_issue_probe && !probe_blocked) {
+        return 0;
+      }
+      num_idle = m_issue_probe ? 1 : 0;
+      if (is_nop_turn) {
+        // Every NOP hands the following tick to the probe turn, which idles while blocked.
+        num_idle += probe_blocked ? 2 * (m_nop_counter - m_curr_nop) : 1;
+      }
+    }
+
+    if (m_warmup_enabled && !m_warmup_reset_done) {
+      num_idle = std::min<Clk_t>(num_idle, m_warmup_cycles - m_clk);
+    }
+    return num_idle;
+  }
+
+  void skip_idle_ticks(Clk_t num_ticks) override {
+    m_clk += num_ticks;
+    if (m_streaming_only || num_ticks == 0) {
+      return;
+    }
+
+    if (m_latency_measure_mode == LatencyMeasureMode::StreamOnly) {
+      m_curr_nop = static_cast<int>((m_curr_nop + num_ticks) % m_nop_counter);
+      return;
+    }
+    if (m_issue_probe) {
+      m_issue_probe = false;
+      num_ticks--;
+    }
+    m_curr_nop = static_cast<int>((m_curr_nop + (num_ticks + 1) / 2) % m_nop_counter);
+    m_issue_probe = (num_ticks % 2 == 1);
+  }
+
   void update_stats() override {
     if (s_probes_completed > 0) {
       s_avg_probe_latency = static_cast<float>(s_total_probe_latency) / s_probes_completed;
@@ -256,12 +304,14 @@ class LatencyThroughputTrace : public IFrontEnd, public Implementation {
     return is_nop;
   }
 
+  bool wants_probe() const {
+    return (!m_warmup_enabled || m_warmup_reset_done) && s_probes_completed < m_latency_sample_count;
+  }
+
   // Handle probe turn: issue a random-address read to measure latency under load.
   // On backpressure, the request is held in m_retry_probe_req for the next attempt.
   void tick_probe() {
-    bool want_probe =
-        ((!m_warmup_enabled || m_warmup_reset_done) && s_probes_completed < m_latency_sample_count);
-    if (!want_probe) {
+    if (!wants_probe()) {
       m_issue_probe = false;
       return;
     }
@@ -1,113 +1,123 @@
-#include <filesystem>
 #include <fmt/format.h>
-#include <fstream>
-#include <iostream>
+
+#include <memory>
+#include <string_view>
 
 #include "ramulator/base/param.h"
 #include "ramulator/frontend/i_frontend.h"
+#include "ramulator/frontend/trace/open_trace.h"
 
 namespace Ramulator {
 
-namespace fs = std::filesystem;
-
 class LoadStoreTrace : public IFrontEnd, public Implementation {
   RAMULATOR_REGISTER_IMPLEMENTATION(IFrontEnd, LoadStoreTrace, "LoadStoreTrace")
 
  private:
-  struct Trace {
-    bool is_write;
-    Addr_t addr;
-  };
-  std::vector<Trace> m_trace;
-
-  size_t m_trace_length = 0;
-  size_t m_curr_trace_idx = 0;
+  using Trace = LoadStoreRecord;
+  std::unique_ptr<TraceStream<Trace>> m_trace;
 
   size_t m_trace_count = 0;
+  bool m_is_stalled = false;  // The last send was rejected by the memory system
   std::string m_trace_path;
+  bool m_prefetch = true;
 
  public:
   void init() override {
     RAMULATOR_PARSE_PARAM(m_clock_ratio, unsigned int, "clock_ratio").required();
     RAMULATOR_PARSE_PARAM(m_trace_path, std::string, "path").required();
+    // Decode the next block of the trace on a background thread while the current one is replayed
+    RAMULATOR_PARSE_PARAM(m_prefetch, bool, "prefetch").default_val(true);
 
-    m_logger.info(fmt::format("Loading trace file {} ...", m_trace_path));
-    init_trace(m_trace_path);
-    m_logger.info(fmt::format("Loaded {} lines.", m_trace.size()));
+    m_logger.info(fmt::format("Streaming trace file {} ...", m_trace_path));
+    m_trace = open_trace_stream<Trace>(
+        m_trace_path, [this](std::string_view line, size_t line_num, Trace& t) { parse_line(line, line_num, t); },
+        m_prefetch);
   };
 
   void tick() override {
-    const Trace& t = m_trace[m_curr_trace_idx];
-    Request req(t.addr, t.is_write ? Request::Type::Write : Request::Type::Read);
+    if (m_trace->empty()) {
+      return;
+    }
+    const Trace& t = m_trace->front();
+    Request req(t.addr, t.type_id);
+    req.src_addr = t.src_addr;
     req.size_bytes = m_memory_system->get_tx_bytes();
     bool request_sent = m_memory_system->send(req);
     if (request_sent) {
-      m_curr_trace_idx = (m_curr_trace_idx + 1) % m_trace_length;
+      m_trace->pop();
       m_trace_count++;
     }
+    m_is_stalled = !request_sent;
   };
 
+  // A rejected request is retried with no other effect until the memory system makes progress.
+  Clk_t get_num_idle_ticks() override {
+    return m_is_stalled ? CLK_NEVER : 0;
+  }
+
  private:
   // Trace format: one memory access per line, space-separated.
   //   <op> <address>
+  //   CP <source address> <destination address>
   //
-  // - op:      LD (read) or ST (write)
+  // - op:      LD (read), ST (write), or ZR (zero the DRAM row holding the address)
+  // - CP:      copy the DRAM row holding the source into the row holding the destination
   // - address: memory address (decimal or 0x hex)
   //
+  // ZR and CP need a standard that accepts Init/Copy requests (e.g., DDR4_RowClone).
+  //
   // Example:
   //   LD 0x12340
   //   ST 4096
+  //   CP 0x200000 0x400000
   //
-  // The trace replays cyclically.
-  void init_trace(const std::string& file_path_str) {
-    fs::path trace_path(file_path_str);
-    if (!fs::exists(trace_path)) {
-      throw std::runtime_error(fmt::format("Trace {} does not exist!", file_path_str));
+  // The trace replays cyclically. It is decoded lazily as it is replayed (one block ahead on a
+  // background thread with prefetch), so a malformed line is only reported once the replay
+  // reaches it. Binary traces written by `python -m ramulator trace convert` are detected and
+  // read as well.
+  void parse_line(std::string_view line, size_t line_num, Trace& t) {
+    std::string_view tokens[3];
+    size_t num_tokens = split_trace_fields(line, ' ', tokens, 3);
+
+    size_t expected_tokens = 2;
+    if (tokens[0] == "LD") {
+      t.type_id = Request::Type::Read;
+    } else if (tokens[0] == "ST") {
+      t.type_id = Request::Type::Write;
+    } else if (tokens[0] == "ZR") {
+      t.type_id = Request::Type::Init;
+    } else if (tokens[0] == "CP") {
+      t.type_id = Request::Type::Copy;
+      expected_tokens = 3;
+    } else {
+      throw std::runtime_error(fmt::format("Trace {} line {}: unknown type '{}' (expected LD, ST, ZR or CP)",
+                                           m_trace_path, line_num, tokens[0]));
     }
 
-    std::ifstream trace_file(trace_path);
-    if (!trace_file.is_open()) {
-      throw std::runtime_error(fmt::format("Trace {} cannot be opened!", file_path_str));
+    if (num_tokens != expected_tokens) {
+      throw std::runtime_error(fmt::format("Trace {} line {}: expected {} tokens, got {}", m_trace_path, line_num,
+                                           expected_tokens, num_tokens));
     }
 
-    std::string line;
-    int line_num = 0;
-    while (std::getline(trace_file, line)) {
-      line_num++;
-      std::vector<std::string> tokens;
-      tokenize(tokens, line, " ");
-
-      if (tokens.size() != 2) {
-        throw std::runtime_error(
-            fmt::format("Trace {} line {}: expected 2 tokens, got {}", file_path_str, line_num, tokens.size()));
-      }
-
-      bool is_write = false;
-      if (tokens[0] == "LD") {
-        is_write = false;
-      } else if (tokens[0] == "ST") {
-        is_write = true;
-      } else {
-        throw std::runtime_error(
-            fmt::format("Trace {} line {}: unknown type '{}' (expected LD or ST)", file_path_str, line_num, tokens[0]));
-      }
-
-      Addr_t addr = -1;
-      if (tokens[1].compare(0, 2, "0x") == 0 || tokens[1].compare(0, 2, "0X") == 0) {
-        addr = std::stoll(tokens[1].substr(2), nullptr, 16);
-      } else {
-        addr = std::stoll(tokens[1]);
-      }
-      m_trace.push_back({is_write, addr});
+    if (t.type_id == Request::Type::Copy) {
+      t.src_addr = parse_addr(tokens[1], line_num);
+      t.addr = parse_addr(tokens[2], line_num);
+    } else {
+      t.src_addr = -1;
+      t.addr = parse_addr(tokens[1], line_num);
     }
+  }
 
-    trace_file.close();
-
-    m_trace_length = m_trace.size();
-  };
+  Addr_t parse_addr(std::string_view token, size_t line_num) const {
+    Addr_t addr = 0;
+    if (!parse_trace_int(token, addr)) {
+      throw std::runtime_error(fmt::format("Trace {} line {}: invalid address '{}'", m_trace_path, line_num, token));
+    }
+    return addr;
+  }
 
   bool is_finished() override {
-    return m_trace_count >= m_trace_length;
+    return m_trace_count >= m_trace->length();
   };
 };
 
@@ -1,51 +1,59 @@
-#include <filesystem>
 #include <fmt/format.h>
-#include <fstream>
-#include <iostream>
+
+#include <memory>
+#include <string_view>
 
 #include "ramulator/base/param.h"
 #include "ramulator/frontend/i_frontend.h"
+#include "ramulator/frontend/trace/open_trace.h"
 
 namespace Ramulator {
 
-namespace fs = std::filesystem;
-
 class ReadWriteTrace : public IFrontEnd, public Implementation {
   RAMULATOR_REGISTER_IMPLEMENTATION(IFrontEnd, ReadWriteTrace, "ReadWriteTrace")
 
  private:
-  struct Trace {
-    bool is_write;
-    AddrVec_t addr_vec;
-  };
-  std::vector<Trace> m_trace;
+  using Trace = ReadWriteRecord;
+  std::unique_ptr<TraceStream<Trace>> m_trace;
 
-  size_t m_trace_length = 0;
-  size_t m_curr_trace_idx = 0;
   size_t m_trace_count = 0;
+  bool m_is_stalled = false;  // The last send was rejected by the memory system
   std::string m_trace_path;
+  bool m_prefetch = true;
 
  public:
   void init() override {
     RAMULATOR_PARSE_PARAM(m_clock_ratio, unsigned int, "clock_ratio").required();
     RAMULATOR_PARSE_PARAM(m_trace_path, std::string, "path").required();
+    // Decode the next block of the trace on a background thread while the current one is replayed
+    RAMULATOR_PARSE_PARAM(m_prefetch, bool, "prefetch").default_val(true);
 
-    m_logger.info(fmt::format("Loading trace file {} ...", m_trace_path));
-    init_trace(m_trace_path);
-    m_logger.info(fmt::format("Loaded {} lines.", m_trace.size()));
+    m_logger.info(fmt::format("Streaming trace file {} ...", m_trace_path));
+    m_trace = open_trace_stream<Trace>(
+        m_trace_path, [this](std::string_view line, size_t line_num, Trace& t) { parse_line(line, line_num, t); },
+        m_prefetch);
   };
 
   void tick() override {
-    const Trace& t = m_trace[m_curr_trace_idx];
+    if (m_trace->empty()) {
+      return;
+    }
+    const Trace& t = m_trace->front();
     Request req(t.addr_vec, t.is_write ? Request::Type::Write : Request::Type::Read);
     req.size_bytes = m_memory_system->get_tx_bytes();
     bool sent = m_memory_system->send(req);
     if (sent) {
-      m_curr_trace_idx = (m_curr_trace_idx + 1) % m_trace_length;
+      m_trace->pop();
       m_trace_count++;
     }
+    m_is_stalled = !sent;
   };
 
+  // A rejected request is retried with no other effect until the memory system makes progress.
+  Clk_t get_num_idle_ticks() override {
+    return m_is_stalled ? CLK_NEVER : 0;
+  }
+
  private:
   // Trace format: one memory access per line, space-separated.
   //   <op> <addr_vec>
@@ -58,58 +66,45 @@ class ReadWriteTrace : public IFrontEnd, public Implementation {
   //   R 0,1,2,100,32
   //   W 0,0,3,200,16
   //
-  // The trace replays cyclically.
-  void init_trace(const std::string& file_path_str) {
-    fs::path trace_path(file_path_str);
-    if (!fs::exists(trace_path)) {
-      throw std::runtime_error(fmt::format("Trace {} does not exist!", file_path_str));
+  // The trace replays cyclically. It is decoded lazily as it is replayed (one block ahead on a
+  // background thread with prefetch), so a malformed line is only reported once the replay
+  // reaches it. Binary traces written by `python -m ramulator trace convert` are detected and
+  // read as well.
+  void parse_line(std::string_view line, size_t line_num, Trace& t) {
+    std::string_view tokens[2];
+    size_t num_tokens = split_trace_fields(line, ' ', tokens, 2);
+    if (num_tokens != 2) {
+      throw std::runtime_error(
+          fmt::format("Trace {} line {}: expected 2 tokens, got {}", m_trace_path, line_num, num_tokens));
     }
 
-    std::ifstream trace_file(trace_path);
-    if (!trace_file.is_open()) {
-      throw std::runtime_error(fmt::format("Trace {} cannot be opened!", file_path_str));
+    if (tokens[0] == "R") {
+      t.is_write = false;
+    } else if (tokens[0] == "W") {
+      t.is_write = true;
+    } else {
+      throw std::runtime_error(
+          fmt::format("Trace {} line {}: unknown type '{}' (expected R or W)", m_trace_path, line_num, tokens[0]));
     }
 
-    std::string line;
-    int line_num = 0;
-    while (std::getline(trace_file, line)) {
-      line_num++;
-      std::vector<std::string> tokens;
-      tokenize(tokens, line, " ");
-
-      if (tokens.size() != 2) {
-        throw std::runtime_error(
-            fmt::format("Trace {} line {}: expected 2 tokens, got {}", file_path_str, line_num, tokens.size()));
-      }
-
-      bool is_write = false;
-      if (tokens[0] == "R") {
-        is_write = false;
-      } else if (tokens[0] == "W") {
-        is_write = true;
-      } else {
-        throw std::runtime_error(
-            fmt::format("Trace {} line {}: unknown type '{}' (expected R or W)", file_path_str, line_num, tokens[0]));
-      }
-
-      std::vector<std::string> addr_vec_tokens;
-      tokenize(addr_vec_tokens, tokens[1], ",");
+    std::string_view addr_vec_tokens[AddrVec::kCapacity];
+    size_t num_levels = split_trace_fields(tokens[1], ',', addr_vec_tokens, AddrVec::kCapacity);
+    if (num_levels > static_cast<size_t>(AddrVec::kCapacity)) {
+      throw std::runtime_error(fmt::format("Trace {} line {}: address vector has {} levels, at most {} are supported",
+                                           m_trace_path, line_num, num_levels, AddrVec::kCapacity));
+    }
 
-      AddrVec_t addr_vec;
-      for (const auto& token : addr_vec_tokens) {
-        addr_vec.push_back(static_cast<int>(std::stoll(token)));
+    t.addr_vec.resize(num_levels);
+    for (size_t i = 0; i < num_levels; i++) {
+      if (!parse_trace_int(addr_vec_tokens[i], t.addr_vec[i])) {
+        throw std::runtime_error(fmt::format("Trace {} line {}: invalid address vector '{}'", m_trace_path,
+                                             line_num, tokens[1]));
       }
-
-      m_trace.push_back({is_write, addr_vec});
     }
-
-    trace_file.close();
-
-    m_trace_length = m_trace.size();
-  };
+  }
 
   bool is_finished() override {
-    return m_trace_count >= m_trace_length;
+    return m_trace_count >= m_trace->length();
   };
 };
 
@@ -0,0 +1,377 @@
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "ramulator/base/param.h"
+#include "ramulator/frontend/i_frontend.h"
+#include "ramulator/frontend/trace/text_trace.h"
+#include "ramulator/frontend/trace/trace_record.h"
+#include "ramulator/frontend/trace/trace_stream.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    Open-loop replay of a trace captured with arrival timestamps
+ *
+ * Unlike LoadStoreTrace, requests are not sent as fast as the memory system accepts them: each
+ * one is injected at its timestamp (divided by time_compression), whatever the state of the
+ * memory system. Injected requests wait in a local queue while the memory system pushes back and
+ * are sent in injection order, at most one transaction per frontend cycle. The latency of every
+ * request is measured from its injection to its completion, so it includes the frontend-side
+ * queueing delay.
+ *
+ * The trace is replayed once. Latencies are reported in frontend cycles (and averaged in ns),
+ * per request in the optional latency_dump_path CSV file.
+ */
+class TimestampedTrace : public IFrontEnd, public Implementation {
+  RAMULATOR_REGISTER_IMPLEMENTATION(IFrontEnd, TimestampedTrace, "TimestampedTrace")
+
+ private:
+  using Trace = TimedRecord;
+
+  // A request being replayed, split into transactions of the memory system's size
+  struct InFlight {
+    Trace record;
+    Clk_t inject_clk = 0;
+    Clk_t send_clk = 0;  // When its last transaction was accepted
+    int num_tx = 0;
+    int num_to_send = 0;
+    int num_outstanding = 0;  // Sent but not completed
+  };
+
+  std::unique_ptr<TraceStream<Trace>> m_trace;
+  std::string m_trace_path;
+  bool m_prefetch = true;
+  std::string m_time_unit;
+  float m_time_compression = 1.0f;
+  int m_num_sources = 1;
+  std::string m_latency_dump_path;
+
+  int m_tx_bytes = 64;
+  double m_clk_per_unit = 1.0;  // Frontend cycles per trace time unit, compression included
+  double m_ns_per_clk = 0.0;    // 0 if the memory system has no clock period
+
+  size_t m_trace_count = 0;
+  double m_last_timestamp = 0.0;
+  std::vector<InFlight> m_slots;
+  std::vector<size_t> m_free_slots;
+  std::deque<size_t> m_pending;  // Slots with transactions left to send, in injection order
+  size_t m_num_in_flight = 0;    // Injected but not completed
+  bool m_is_stalled = false;     // The last send was rejected by the memory system
+  std::ofstream m_latency_dump;
+
+  // Stats, in frontend cycles
+  size_t s_num_injected = 0;
+  size_t s_num_completed = 0;
+  size_t s_max_pending = 0;
+  uint64_t s_total_queue_wait = 0;
+  uint64_t s_total_latency = 0;
+  Clk_t s_max_latency = 0;
+  float s_avg_queue_wait = 0.0f;
+  float s_avg_latency = 0.0f;
+  float s_avg_latency_ns = 0.0f;
+  std::vector<uint64_t> s_num_completed_per_source;
+  std::vector<uint64_t> s_total_latency_per_source;
+  std::vector<float> s_avg_latency_per_source;
+
+ public:
+  void init() override {
+    RAMULATOR_PARSE_PARAM(m_clock_ratio, unsigned int, "clock_ratio").required();
+    RAMULATOR_PARSE_PARAM(m_trace_path, std::string, "path").required();
+    // Decode the next block of the trace on a background thread while the current one is replayed
+    RAMULATOR_PARSE_PARAM(m_prefetch, bool, "prefetch").default_val(true);
+    // Unit of the timestamps: "cycle" (frontend cycles) or "ns"
+    RAMULATOR_PARSE_PARAM(m_time_unit, std::string, "time_unit").default_val("cycle");
+    // Timestamps are divided by this factor (e.g., 2 replays the trace at twice its rate)
+    RAMULATOR_PARSE_PARAM(m_time_compression, float, "time_compression").default_val(1.0f);
+    RAMULATOR_PARSE_PARAM(m_num_sources, int, "num_sources").default_val(1);
+    RAMULATOR_PARSE_PARAM(m_latency_dump_path, std::string, "latency_dump_path").default_val("");
+
+    if (m_time_unit != "cycle" && m_time_unit != "ns") {
+      throw std::runtime_error(
+          fmt::format("TimestampedTrace: invalid time_unit '{}'; expected 'cycle' or 'ns'", m_time_unit));
+    }
+    if (!(m_time_compression > 0.0)) {
+      throw std::runtime_error(
+          fmt::format("TimestampedTrace: time_compression must be > 0 (got {})", m_time_compression));
+    }
+    if (m_num_sources <= 0) {
+      throw std::runtime_error(fmt::format("TimestampedTrace: num_sources must be > 0 (got {})", m_num_sources));
+    }
+
+    if (!m_latency_dump_path.empty()) {
+      m_latency_dump.open(m_latency_dump_path);
+      if (!m_latency_dump) {
+        throw std::runtime_error(fmt::format("TimestampedTrace: cannot open {} for writing", m_latency_dump_path));
+      }
+      m_latency_dump << "timestamp,source_id,op,addr,size_bytes,inject_cycle,queue_wait,latency\n";
+    }
+
+    m_logger.info(fmt::format("Streaming trace file {} ...", m_trace_path));
+    auto source = std::make_unique<TextTraceSource<Trace>>(
+        m_trace_path, [this](std::string_view line, size_t line_num, Trace& t) { parse_line(line, line_num, t); });
+    m_trace = std::make_unique<TraceStream<Trace>>(std::move(source), m_prefetch);
+
+    s_num_completed_per_source.resize(m_num_sources, 0);
+    s_total_latency_per_source.resize(m_num_sources, 0);
+    s_avg_latency_per_source.resize(m_num_sources, 0.0f);
+
+    m_stats.add("num_requests_injected", s_num_injected);
+    m_stats.add("num_requests_completed", s_num_completed);
+    m_stats.add("max_pending_requests", s_max_pending);
+    m_stats.add("total_queue_wait", s_total_queue_wait);
+    m_stats.add("avg_queue_wait", s_avg_queue_wait);
+    m_stats.add("total_latency", s_total_latency);
+    m_stats.add("avg_latency", s_avg_latency);
+    m_stats.add("max_latency", s_max_latency);
+    m_stats.add("avg_latency_ns", s_avg_latency_ns);
+    m_stats.add("num_requests_completed_per_source", s_num_completed_per_source);
+    m_stats.add("avg_latency_per_source", s_avg_latency_per_source);
+  };
+
+  void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
+    m_tx_bytes = memory_system->get_tx_bytes();
+
+    // The memory system ticks clock_ratio times for every m_clock_ratio frontend ticks
+    float tCK = memory_system->get_tCK();
+    m_ns_per_clk = tCK > 0 ? static_cast<double>(tCK) * memory_system->get_clock_ratio() / m_clock_ratio : 0.0;
+    if (m_time_unit == "ns") {
+      if (m_ns_per_clk <= 0.0) {
+        throw std::runtime_error("TimestampedTrace: time_unit 'ns' needs a memory system with a clock period");
+      }
+      m_clk_per_unit = 1.0 / m_ns_per_clk;
+    }
+    m_clk_per_unit /= m_time_compression;
+  }
+
+  int get_num_cores() override {
+    return m_num_sources;
+  }
+
+  void tick() override {
+    m_clk++;
+    inject_due_requests();
+    if (m_pending.empty()) {
+      m_is_stalled = false;
+      return;
+    }
+
+    size_t slot = m_pending.front();
+    InFlight& f = m_slots[slot];
+    const Trace& t = f.record;
+    Request req(t.addr + static_cast<Addr_t>(f.num_tx - f.num_to_send) * m_tx_bytes, t.type_id, t.source_id,
+                [this, slot](Request&) { complete(slot); });
+    req.size_bytes = m_tx_bytes;
+
+    // Account for the transaction first: a coalesced write completes within send()
+    f.num_to_send--;
+    f.num_outstanding++;
+    f.send_clk = m_clk;
+    bool is_last = f.num_to_send == 0;
+    if (!m_memory_system->send(req)) {
+      f.num_to_send++;
+      f.num_outstanding--;
+      m_is_stalled = true;
+      return;
+    }
+    m_is_stalled = false;
+    if (is_last) {
+      m_pending.pop_front();
+    }
+  };
+
+  // Nothing happens until the next timestamp while the queue is empty, and a rejected
+  // transaction is retried with no other effect until the memory system makes progress
+  // (requests injected meanwhile are queued at their own timestamps once ticking resumes).
+  Clk_t get_num_idle_ticks() override {
+    if (!m_pending.empty()) {
+      return m_is_stalled ? CLK_NEVER : 0;
+    }
+    if (is_trace_done()) {
+      return CLK_NEVER;
+    }
+    return std::max<Clk_t>(inject_clk_of(m_trace->front()) - m_clk - 1, 0);
+  }
+
+  void skip_idle_ticks(Clk_t num_ticks) override {
+    m_clk += num_ticks;
+  }
+
+  bool is_finished() override {
+    return is_trace_done() && m_num_in_flight == 0;
+  };
+
+  void update_stats() override {
+    if (s_num_completed > 0) {
+      s_avg_queue_wait = static_cast<float>(s_total_queue_wait) / s_num_completed;
+      s_avg_latency = static_cast<float>(s_total_latency) / s_num_completed;
+      s_avg_latency_ns = static_cast<float>(s_avg_latency * m_ns_per_clk);
+    }
+    for (int source = 0; source < m_num_sources; source++) {
+      if (s_num_completed_per_source[source] > 0) {
+        s_avg_latency_per_source[source] =
+            static_cast<float>(s_total_latency_per_source[source]) / s_num_completed_per_source[source];
+      }
+    }
+  }
+
+  void finalize() override {
+    update_stats();
+    if (m_latency_dump.is_open()) {
+      m_latency_dump.close();
+    }
+  }
+
+  void reset_stats() override {
+    s_num_injected = 0;
+    s_num_completed = 0;
+    s_max_pending = 0;
+    s_total_queue_wait = 0;
+    s_total_latency = 0;
+    s_max_latency = 0;
+    s_avg_queue_wait = 0.0f;
+    s_avg_latency = 0.0f;
+    s_avg_latency_ns = 0.0f;
+    std::fill(s_num_completed_per_source.begin(), s_num_completed_per_source.end(), 0);
+    std::fill(s_total_latency_per_source.begin(), s_total_latency_per_source.end(), 0);
+    std::fill(s_avg_latency_per_source.begin(), s_avg_latency_per_source.end(), 0.0f);
+  }
+
+ private:
+  bool is_trace_done() const {
+    return m_trace->empty() || m_trace_count >= m_trace->length();
+  }
+
+  Clk_t inject_clk_of(const Trace& t) const {
+    return static_cast<Clk_t>(std::ceil(t.timestamp * m_clk_per_unit));
+  }
+
+  // Move every request whose timestamp has been reached into the local queue
+  void inject_due_requests() {
+    while (!is_trace_done()) {
+      const Trace& t = m_trace->front();
+      Clk_t inject_clk = inject_clk_of(t);
+      if (inject_clk > m_clk) {
+        break;
+      }
+      if (t.timestamp < m_last_timestamp) {
+        throw std::runtime_error(fmt::format("Trace {}: timestamps must not decrease (request {} at {} after {})",
+                                             m_trace_path, m_trace_count + 1, t.timestamp, m_last_timestamp));
+      }
+      m_last_timestamp = t.timestamp;
+
+      size_t slot;
+      if (m_free_slots.empty()) {
+        slot = m_slots.size();
+        m_slots.emplace_back();
+      } else {
+        slot = m_free_slots.back();
+        m_free_slots.pop_back();
+      }
+      InFlight& f = m_slots[slot];
+      f.record = t;
+      f.inject_clk = inject_clk;
+      f.num_tx = t.size_bytes > 0 ? (t.size_bytes + m_tx_bytes - 1) / m_tx_bytes : 1;
+      f.num_to_send = f.num_tx;
+      f.num_outstanding = 0;
+
+      m_pending.push_back(slot);
+      m_num_in_flight++;
+      s_num_injected++;
+      s_max_pending = std::max(s_max_pending, m_pending.size());
+
+      m_trace->pop();
+      m_trace_count++;
+    }
+  }
+
+  // Called as each transaction completes; the request is done with its last one
+  void complete(size_t slot) {
+    InFlight& f = m_slots[slot];
+    if (--f.num_outstanding > 0 || f.num_to_send > 0) {
+      return;
+    }
+
+    const Trace& t = f.record;
+    Clk_t queue_wait = f.send_clk - f.inject_clk;
+    Clk_t latency = m_clk - f.inject_clk;
+    s_num_completed++;
+    s_total_queue_wait += queue_wait;
+    s_total_latency += latency;
+    s_max_latency = std::max(s_max_latency, latency);
+    s_num_completed_per_source[t.source_id]++;
+    s_total_latency_per_source[t.source_id] += latency;
+    if (m_latency_dump.is_open()) {
+      m_latency_dump << fmt::format("{},{},{},{:#x},{},{},{},{}\n", t.timestamp, t.source_id,
+                                    t.type_id == Request::Type::Write ? "ST" : "LD", t.addr,
+                                    f.num_tx * m_tx_bytes, f.inject_clk, queue_wait, latency);
+    }
+
+    m_free_slots.push_back(slot);
+    m_num_in_flight--;
+  }
+
+  // Trace format: one request per line, space-separated, in non-decreasing timestamp order.
+  //   <timestamp> <op> <address> [<size> [<source_id>]]
+  //
+  // - timestamp: injection time in time_unit (may be fractional)
+  // - op:        LD (read) or ST (write)
+  // - address:   memory address (decimal or 0x hex)
+  // - size:      request size in bytes (default: one memory system transaction). Larger requests
+  //              are split into consecutive transactions and complete with the last one.
+  // - source_id: issuing source in [0, num_sources) (default 0)
+  //
+  // Example:
+  //   0 LD 0x12340
+  //   12.5 ST 4096 128 1
+  void parse_line(std::string_view line, size_t line_num, Trace& t) {
+    std::string_view tokens[5];
+    size_t num_tokens = split_trace_fields(line, ' ', tokens, 5);
+    if (num_tokens < 3 || num_tokens > 5) {
+      throw std::runtime_error(
+          fmt::format("Trace {} line {}: expected 3 to 5 tokens, got {}", m_trace_path, line_num, num_tokens));
+    }
+
+    const char* ts_end = tokens[0].data() + tokens[0].size();
+    auto [ptr, ec] = std::from_chars(tokens[0].data(), ts_end, t.timestamp);
+    if (ec != std::errc() || ptr != ts_end || tokens[0].empty() || !std::isfinite(t.timestamp) || t.timestamp < 0) {
+      throw std::runtime_error(
+          fmt::format("Trace {} line {}: invalid timestamp '{}'", m_trace_path, line_num, tokens[0]));
+    }
+
+    if (tokens[1] == "LD") {
+      t.type_id = Request::Type::Read;
+    } else if (tokens[1] == "ST") {
+      t.type_id = Request::Type::Write;
+    } else {
+      throw std::runtime_error(
+          fmt::format("Trace {} line {}: unknown type '{}' (expected LD or ST)", m_trace_path, line_num, tokens[1]));
+    }
+
+    if (!parse_trace_int(tokens[2], t.addr)) {
+      throw std::runtime_error(
+          fmt::format("Trace {} line {}: invalid address '{}'", m_trace_path, line_num, tokens[2]));
+    }
+
+    t.size_bytes = -1;
+    if (num_tokens >= 4 && (!parse_trace_int(tokens[3], t.size_bytes) || t.size_bytes <= 0)) {
+      throw std::runtime_error(fmt::format("Trace {} line {}: invalid size '{}'", m_trace_path, line_num, tokens[3]));
+    }
+
+    t.source_id = 0;
+    if (num_tokens == 5 &&
+        (!parse_trace_int(tokens[4], t.source_id) || t.source_id < 0 || t.source_id >= m_num_sources)) {
+      throw std::runtime_error(fmt::format("Trace {} line {}: invalid source id '{}' (num_sources is {})",
+                                           m_trace_path, line_num, tokens[4], m_num_sources));
+    }
+  }
+};
+
+}  // namespace Ramulator
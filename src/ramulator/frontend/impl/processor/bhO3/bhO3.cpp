@@ -2,8 +2,12 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <thread>
+
 #include "ramulator/base/param.h"
 #include "ramulator/base/utils.h"
+#include "ramulator/base/worker_pool.h"
 #include "ramulator/frontend/impl/processor/bhO3/bhcore.h"
 #include "ramulator/frontend/impl/processor/bhO3/bhllc.h"
 
@@ -34,6 +38,11 @@ void BHO3::init() {
   // [] to mark no cores as attackers; pass [0, 3] to mark cores 0 and 3.
   RAMULATOR_PARSE_PARAM(m_attacker_core_ids, std::vector<int>, "attacker_core_ids")
       .default_val(std::vector<int>{});
+  // Threads that load the cores' traces (0: all hardware threads)
+  RAMULATOR_PARSE_PARAM(m_trace_load_threads, int, "trace_load_threads").default_val(0);
+  if (m_trace_load_threads < 0) {
+    throw std::runtime_error(fmt::format("BHO3 trace_load_threads must be >= 0 (got {})", m_trace_load_threads));
+  }
 
   m_num_cores = m_traces.size();
   int llc_capacity_per_core = parse_capacity_str(m_llc_capacity_str);
@@ -52,13 +61,19 @@ void BHO3::init() {
                                     m_llc_num_mshr_per_core * m_num_cores,
                                     m_num_cores);
 
-  for (int id = 0; id < m_num_cores; id++) {
-    auto core = std::make_unique<BHO3Core>(m_clk, id, m_ipc, m_depth, m_num_expected_insts,
-                                           m_num_max_cycles, m_traces[id], m_translation,
-                                           m_llc.get(), m_lat_hist_sens, m_dump_path,
-                                           is_attacker[id]);
+  // Load the cores' traces concurrently, splitting the threads between them
+  int num_load_threads = m_trace_load_threads > 0 ? m_trace_load_threads
+                                                  : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  int threads_per_core = std::max(1, num_load_threads / std::max(m_num_cores, 1));
+  m_cores.resize(m_num_cores);
+  WorkerPool(std::max(1, std::min(num_load_threads, m_num_cores))).run(m_num_cores, [&](int id) {
+    m_cores[id] = std::make_unique<BHO3Core>(m_clk, id, m_ipc, m_depth, m_num_expected_insts,
+                                             m_num_max_cycles, m_traces[id], threads_per_core,
+                                             m_translation, m_llc.get(), m_lat_hist_sens, m_dump_path,
+                                             is_attacker[id]);
+  });
+  for (auto& core : m_cores) {
     core->m_callback = [this](Request& req) { return this->receive(req); };
-    m_cores.push_back(std::move(core));
   }
 
   m_stats.add("num_expected_insts", m_num_expected_insts);
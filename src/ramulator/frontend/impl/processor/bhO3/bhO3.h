@@ -53,6 +53,7 @@ class BHO3 final : public IFrontEnd, public Implementation {
   int m_lat_hist_sens;
   std::string m_dump_path;
   std::vector<int> m_attacker_core_ids;  // ids of cores marked as attackers
+  int m_trace_load_threads;
 };
 
 }  // namespace Ramulator
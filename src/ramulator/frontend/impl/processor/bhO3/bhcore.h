@@ -9,6 +9,7 @@
 
 #include "ramulator/base/request.h"
 #include "ramulator/base/type.h"
+#include "ramulator/frontend/trace/trace_record.h"
 #include "ramulator/translation/i_translation.h"
 
 namespace Ramulator {
@@ -23,18 +24,14 @@ class BHO3Core {
   friend class BHO3;
   class Trace {
     friend class BHO3Core;
-    struct Inst {
-      int bubble_count = 0;
-      Addr_t load_addr = -1;
-      Addr_t store_addr = -1;
-    };
+    using Inst = InstRecord;
 
     std::vector<Inst> m_trace;
     size_t m_trace_length = 0;
     size_t m_curr_trace_idx = 0;
 
    public:
-    Trace(std::string file_path_str);
+    Trace(std::string file_path_str, int num_load_threads);
     const Inst& get_next_inst();
   };
 
@@ -70,7 +67,7 @@ class BHO3Core {
   ITranslation* m_translation;
   BHO3LLC* m_llc;
 
-  std::function<void(Request&)> m_callback;
+  RequestCallback m_callback;
 
   int m_num_bubbles = 0;
   Addr_t m_load_addr = -1;
@@ -97,8 +94,8 @@ class BHO3Core {
 
  public:
   BHO3Core(const Clk_t& clk, int id, int ipc, int depth, size_t num_expected_insts,
-           uint64_t num_max_cycles, std::string trace_path, ITranslation* translation,
-           BHO3LLC* llc, int lat_hist_sens, std::string dump_path, bool is_attacker);
+           uint64_t num_max_cycles, std::string trace_path, int num_trace_load_threads,
+           ITranslation* translation, BHO3LLC* llc, int lat_hist_sens, std::string dump_path, bool is_attacker);
 
   void tick();
   void receive(Request& req);
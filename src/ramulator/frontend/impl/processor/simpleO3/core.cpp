@@ -1,50 +1,15 @@
 #include "ramulator/frontend/impl/processor/simpleO3/core.h"
 
-#include <filesystem>
 #include <fmt/format.h>
-#include <fstream>
 #include <iostream>
 
-#include "ramulator/base/utils.h"
 #include "ramulator/frontend/impl/processor/simpleO3/llc.h"
+#include "ramulator/frontend/trace/inst_trace.h"
 
 namespace Ramulator {
 
-namespace fs = std::filesystem;
-
-SimpleO3Core::Trace::Trace(std::string file_path_str) {
-  fs::path trace_path(file_path_str);
-  if (!fs::exists(trace_path)) {
-    throw std::runtime_error(fmt::format("Trace {} does not exist!", file_path_str));
-  }
-
-  std::ifstream trace_file(trace_path);
-  if (!trace_file.is_open()) {
-    throw std::runtime_error(fmt::format("Trace {} cannot be opened!", file_path_str));
-  }
-
-  std::string line;
-  while (std::getline(trace_file, line)) {
-    std::vector<std::string> tokens;
-    tokenize(tokens, line, " ");
-
-    int num_tokens = tokens.size();
-    if (num_tokens != 2 && num_tokens != 3) {
-      throw std::runtime_error(fmt::format("Trace {} format invalid!", file_path_str));
-    }
-    int bubble_count = std::stoi(tokens[0]);
-    Addr_t load_addr = std::stoll(tokens[1]);
-
-    bool has_store = num_tokens == 2 ? false : true;
-    if (has_store) {
-      Addr_t store_addr = std::stoll(tokens[2]);
-      m_trace.push_back({bubble_count, load_addr, store_addr});
-    } else {
-      m_trace.push_back({bubble_count, load_addr, -1});
-    }
-  }
-
-  trace_file.close();
+SimpleO3Core::Trace::Trace(std::string file_path_str, int num_load_threads) {
+  load_inst_trace(file_path_str, m_trace, num_load_threads);
   m_trace_length = m_trace.size();
 }
 
@@ -105,11 +70,12 @@ void SimpleO3Core::InstWindow::set_ready(Addr_t addr) {
 }
 
 SimpleO3Core::SimpleO3Core(const Clk_t& clk, int id, int ipc, int depth, size_t num_expected_insts,
-                           std::string trace_path, ITranslation* translation, SimpleO3LLC* llc)
+                           std::string trace_path, int num_trace_load_threads, ITranslation* translation,
+                           SimpleO3LLC* llc)
     : m_clk(clk),
       m_id(id),
       m_window(ipc, depth),
-      m_trace(trace_path),
+      m_trace(trace_path, num_trace_load_threads),
       m_num_expected_insts(num_expected_insts),
       m_translation(translation),
       m_llc(llc) {
@@ -188,6 +154,13 @@ void SimpleO3Core::tick() {
   m_writeback_addr = inst.store_addr;
 }
 
+bool SimpleO3Core::is_stalled() {
+  if (!m_window.is_full() || m_window.m_ready_list[m_window.m_tail_idx]) {
+    return false;
+  }
+  return m_num_bubbles > 0 || m_load_addr != -1;
+}
+
 void SimpleO3Core::receive(Request& req) {
   m_window.set_ready(req.addr);
 
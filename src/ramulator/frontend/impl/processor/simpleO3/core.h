@@ -7,6 +7,7 @@
 
 #include "ramulator/base/request.h"
 #include "ramulator/base/type.h"
+#include "ramulator/frontend/trace/trace_record.h"
 #include "ramulator/translation/i_translation.h"
 
 namespace Ramulator {
@@ -17,18 +18,14 @@ class SimpleO3Core {
   friend class SimpleO3;
   class Trace {
     friend class SimpleO3Core;
-    struct Inst {
-      int bubble_count = 0;
-      Addr_t load_addr = -1;
-      Addr_t store_addr = -1;
-    };
+    using Inst = InstRecord;
 
     std::vector<Inst> m_trace;
     size_t m_trace_length = 0;
     size_t m_curr_trace_idx = 0;
 
    public:
-    Trace(std::string file_path_str);
+    Trace(std::string file_path_str, int num_load_threads);
     const Inst& get_next_inst();
   };
 
@@ -88,7 +85,7 @@ class SimpleO3Core {
   ITranslation* m_translation;
   SimpleO3LLC* m_llc;
 
-  std::function<void(Request&)> m_callback;
+  RequestCallback m_callback;
 
   int m_num_bubbles = 0;
   Addr_t m_load_addr = -1;
@@ -108,7 +105,7 @@ class SimpleO3Core {
 
  public:
   SimpleO3Core(const Clk_t& clk, int id, int ipc, int depth, size_t num_expected_insts, std::string trace_path,
-               ITranslation* translation, SimpleO3LLC* llc);
+               int num_trace_load_threads, ITranslation* translation, SimpleO3LLC* llc);
 
   /**
    * @brief   Ticks the core.
@@ -121,6 +118,15 @@ class SimpleO3Core {
    *
    */
   void receive(Request& req);
+
+  /**
+   * @brief   Whether tick() is a no-op until a memory request completes.
+   *
+   * @details
+   * True when the window is full, its oldest instruction is waiting on memory, and the next
+   * instruction to insert needs a window slot.
+   */
+  bool is_stalled();
 };
 
 }  // namespace Ramulator
@@ -57,6 +57,19 @@ void SimpleO3LLC::tick() {
   }
 };
 
+Clk_t SimpleO3LLC::get_next_event_clk() const {
+  Clk_t next = CLK_NEVER;
+  for (const auto& [due, req] : m_miss_list) {
+    if (due > m_clk) {
+      next = std::min(next, due);
+    }
+  }
+  for (const auto& [due, req] : m_hit_list) {
+    next = std::min(next, std::max(due, m_clk + 1));
+  }
+  return next;
+}
+
 bool SimpleO3LLC::send(Request& req) {
   CacheSet_t& set = get_set(req.addr);
 
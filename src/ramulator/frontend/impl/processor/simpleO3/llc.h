@@ -72,6 +72,10 @@ class SimpleO3LLC {
   bool send(Request& req);
   void receive(Request& req);
 
+  // Earliest cycle after m_clk at which tick() has work, assuming the memory system keeps
+  // rejecting misses that are already due (CLK_NEVER if none).
+  Clk_t get_next_event_clk() const;
+
   void serialize(std::string serialization_filename);
   void deserialize(std::string serialization_filename);
   void dump_llc();
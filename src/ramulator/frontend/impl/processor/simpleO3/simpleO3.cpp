@@ -1,9 +1,11 @@
 #include <fmt/format.h>
 #include <functional>
 #include <memory>
+#include <thread>
 
 #include "ramulator/base/param.h"
 #include "ramulator/base/utils.h"
+#include "ramulator/base/worker_pool.h"
 #include "ramulator/frontend/i_frontend.h"
 #include "ramulator/frontend/impl/processor/simpleO3/core.h"
 #include "ramulator/frontend/impl/processor/simpleO3/llc.h"
@@ -23,7 +25,9 @@ namespace Ramulator {
 //   3 20734016
 //   8 20841280 20841280
 //
-// The trace replays cyclically.
+// The trace replays cyclically. Binary traces written by `python -m ramulator trace convert`
+// are detected and read as well. The cores' traces are loaded concurrently, each split into
+// line-aligned chunks parsed in parallel, on trace_load_threads threads in total.
 class SimpleO3 final : public IFrontEnd, public Implementation {
   RAMULATOR_REGISTER_IMPLEMENTATION(IFrontEnd, SimpleO3, "SimpleO3")
 
@@ -43,6 +47,7 @@ class SimpleO3 final : public IFrontEnd, public Implementation {
   int m_llc_associativity;
   int m_llc_num_mshr_per_core;
   std::string m_llc_capacity_str;
+  int m_trace_load_threads;
 
  public:
   void init() override {
@@ -56,6 +61,11 @@ class SimpleO3 final : public IFrontEnd, public Implementation {
     RAMULATOR_PARSE_PARAM(m_llc_associativity, int, "llc_associativity").default_val(8);
     RAMULATOR_PARSE_PARAM(m_llc_capacity_str, std::string, "llc_capacity_per_core").default_val("2MB");
     RAMULATOR_PARSE_PARAM(m_llc_num_mshr_per_core, int, "llc_num_mshr_per_core").default_val(16);
+    // 0: use all hardware threads
+    RAMULATOR_PARSE_PARAM(m_trace_load_threads, int, "trace_load_threads").default_val(0);
+    if (m_trace_load_threads < 0) {
+      throw std::runtime_error(fmt::format("SimpleO3 trace_load_threads must be >= 0 (got {})", m_trace_load_threads));
+    }
 
     m_num_cores = m_traces.size();
     int llc_capacity_per_core = parse_capacity_str(m_llc_capacity_str);
@@ -66,11 +76,17 @@ class SimpleO3 final : public IFrontEnd, public Implementation {
                                           m_llc_linesize_bytes, m_llc_associativity,
                                           m_llc_num_mshr_per_core * m_num_cores);
 
-    for (int id = 0; id < m_num_cores; id++) {
-      auto core = std::make_unique<SimpleO3Core>(m_clk, id, m_ipc, m_depth, m_num_expected_insts, m_traces[id],
-                                                 m_translation, m_llc.get());
+    // Load the cores' traces concurrently, splitting the threads between them
+    int num_load_threads = m_trace_load_threads > 0 ? m_trace_load_threads
+                                                    : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    int threads_per_core = std::max(1, num_load_threads / std::max(m_num_cores, 1));
+    m_cores.resize(m_num_cores);
+    WorkerPool(std::max(1, std::min(num_load_threads, m_num_cores))).run(m_num_cores, [&](int id) {
+      m_cores[id] = std::make_unique<SimpleO3Core>(m_clk, id, m_ipc, m_depth, m_num_expected_insts, m_traces[id],
+                                                   threads_per_core, m_translation, m_llc.get());
+    });
+    for (auto& core : m_cores) {
       core->m_callback = [this](Request& req) { return this->receive(req); };
-      m_cores.push_back(std::move(core));
     }
 
     m_stats.add("num_expected_insts", m_num_expected_insts);
@@ -87,10 +103,11 @@ class SimpleO3 final : public IFrontEnd, public Implementation {
     }
   }
 
+  static constexpr Clk_t kHeartbeatInterval = 10'000'000;
+
   void tick() override {
     m_clk++;
 
-    constexpr Clk_t kHeartbeatInterval = 10'000'000;
     if (m_clk % kHeartbeatInterval == 0) {
       m_logger.info(fmt::format("Processor Heartbeat {} cycles.", m_clk));
     }
@@ -101,6 +118,24 @@ class SimpleO3 final : public IFrontEnd, public Implementation {
     }
   }
 
+  Clk_t get_num_idle_ticks() override {
+    for (auto& core : m_cores) {
+      if (!core->is_stalled()) {
+        return 0;
+      }
+    }
+    Clk_t next = m_llc->get_next_event_clk();
+    return next == CLK_NEVER ? CLK_NEVER : next - m_clk - 1;
+  }
+
+  void skip_idle_ticks(Clk_t num_ticks) override {
+    for (Clk_t beat = (m_clk / kHeartbeatInterval + 1) * kHeartbeatInterval; beat <= m_clk + num_ticks;
+         beat += kHeartbeatInterval) {
+      m_logger.info(fmt::format("Processor Heartbeat {} cycles.", beat));
+    }
+    m_clk += num_ticks;
+  }
+
   void receive(Request& req) {
     m_llc->receive(req);
 
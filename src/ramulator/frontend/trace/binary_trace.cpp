@@ -0,0 +1,170 @@
+#include "ramulator/frontend/trace/binary_trace.h"
+
+#include <fmt/format.h>
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace Ramulator {
+
+namespace {
+
+constexpr char MAGIC[8] = {'R', 'A', 'M', 'T', 'R', 'A', 'C', 'E'};
+constexpr size_t HEADER_SIZE = 48;
+
+template <typename Int_t>
+Int_t load_le(const char* p) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < sizeof(Int_t); i++) {
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(p[i])) << (8 * i);
+  }
+  return static_cast<Int_t>(value);
+}
+
+// Wrapping addition, as the deltas were taken modulo 2^64
+Addr_t add_delta(Addr_t base, int64_t delta) {
+  return static_cast<Addr_t>(static_cast<uint64_t>(base) + static_cast<uint64_t>(delta));
+}
+
+}  // namespace
+
+bool BinaryTraceReader::is_binary_trace(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  char magic[sizeof(MAGIC)];
+  return file.read(magic, sizeof(magic)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+BinaryTraceReader::BinaryTraceReader(const std::string& path) : m_file(path) {
+  const char* data = m_file.data();
+  if (m_file.size() < HEADER_SIZE || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+    throw std::runtime_error(fmt::format("Trace {} is not a binary trace!", path));
+  }
+
+  uint32_t version = load_le<uint32_t>(data + 8);
+  if (version != VERSION) {
+    throw std::runtime_error(
+        fmt::format("Trace {} has binary format version {}, only version {} is supported!", path, version, VERSION));
+  }
+
+  uint8_t kind = load_le<uint8_t>(data + 12);
+  m_addr_vec_size = load_le<uint8_t>(data + 13);
+  m_block_records = load_le<uint32_t>(data + 16);
+  m_num_records = load_le<uint64_t>(data + 24);
+  uint64_t num_blocks = load_le<uint64_t>(data + 32);
+  m_data_end = load_le<uint64_t>(data + 40);
+
+  if (kind < static_cast<uint8_t>(BinaryTraceKind::LoadStore) || kind > static_cast<uint8_t>(BinaryTraceKind::Inst)) {
+    corrupt("unknown record kind");
+  }
+  m_kind = static_cast<BinaryTraceKind>(kind);
+  if (m_kind == BinaryTraceKind::ReadWrite && m_num_records > 0 &&
+      (m_addr_vec_size <= 0 || m_addr_vec_size > AddrVec::kCapacity)) {
+    corrupt("invalid address vector size");
+  }
+  if (m_block_records == 0 || num_blocks != (m_num_records + m_block_records - 1) / m_block_records) {
+    corrupt("inconsistent block count");
+  }
+  if (m_data_end < HEADER_SIZE || m_data_end > m_file.size() || (m_file.size() - m_data_end) / 8 != num_blocks ||
+      (m_file.size() - m_data_end) % 8 != 0) {
+    corrupt("invalid block index");
+  }
+
+  m_block_offsets.resize(num_blocks);
+  uint64_t prev_offset = HEADER_SIZE;
+  for (uint64_t block = 0; block < num_blocks; block++) {
+    uint64_t offset = load_le<uint64_t>(data + m_data_end + 8 * block);
+    if (offset < prev_offset || offset > m_data_end || (block == 0 && offset != HEADER_SIZE)) {
+      corrupt("invalid block index");
+    }
+    m_block_offsets[block] = offset;
+    prev_offset = offset;
+  }
+
+  m_prev_addr_vec.resize(m_addr_vec_size);
+  seek_block(0);
+}
+
+void BinaryTraceReader::expect_kind(BinaryTraceKind kind) const {
+  static const char* names[] = {"", "LoadStore", "ReadWrite", "Inst"};
+  if (m_kind != kind) {
+    throw std::runtime_error(fmt::format("Trace {} holds {} records, but {} records are expected!", path(),
+                                         names[static_cast<int>(m_kind)], names[static_cast<int>(kind)]));
+  }
+}
+
+void BinaryTraceReader::seek_block(uint64_t block) {
+  m_record_idx = std::min<uint64_t>(block * m_block_records, m_num_records);
+  m_pos = nullptr;
+  m_end = nullptr;
+}
+
+void BinaryTraceReader::begin_record() {
+  if (m_record_idx >= m_num_records) {
+    throw std::runtime_error(fmt::format("Trace {}: read past the last record!", path()));
+  }
+  if (m_pos && m_record_idx % m_block_records != 0) {
+    return;
+  }
+  if (m_pos && m_pos != m_end) {
+    corrupt("block holds more data than its records");
+  }
+
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(m_file.data());
+  uint64_t block = m_record_idx / m_block_records;
+  m_pos = data + m_block_offsets[block];
+  m_end = data + (block + 1 < m_block_offsets.size() ? m_block_offsets[block + 1] : m_data_end);
+
+  m_prev_addr = 0;
+  std::fill(m_prev_addr_vec.begin(), m_prev_addr_vec.end(), 0);
+
+  size_t offset = m_block_offsets[block];
+  if (offset < m_released) {
+    m_file.release(m_released, m_file.size());  // Rewound
+    m_released = 0;
+  } else if (offset - m_released >= RELEASE_CHUNK_BYTES) {
+    m_file.release(m_released, offset);
+    m_released = offset;
+  }
+}
+
+void BinaryTraceReader::corrupt(const char* what) const {
+  throw std::runtime_error(fmt::format("Trace {} is corrupt ({})!", path(), what));
+}
+
+void BinaryTraceReader::read(LoadStoreRecord& record) {
+  static constexpr int types[] = {Request::Type::Read, Request::Type::Write, Request::Type::Init, Request::Type::Copy};
+
+  begin_record();
+  uint64_t head = read_varint();
+  record.type_id = types[head & 3];
+  record.addr = add_delta(m_prev_addr, unzigzag(head >> 2));
+  record.src_addr = (record.type_id == Request::Type::Copy) ? add_delta(record.addr, read_svarint()) : -1;
+  m_prev_addr = record.addr;
+  m_record_idx++;
+}
+
+void BinaryTraceReader::read(ReadWriteRecord& record) {
+  begin_record();
+  record.addr_vec.resize(m_addr_vec_size);
+  uint64_t head = read_varint();
+  record.is_write = head & 1;
+  record.addr_vec[0] = m_prev_addr_vec[0] + static_cast<int>(unzigzag(head >> 1));
+  for (int level = 1; level < m_addr_vec_size; level++) {
+    record.addr_vec[level] = m_prev_addr_vec[level] + static_cast<int>(read_svarint());
+  }
+  m_prev_addr_vec = record.addr_vec;
+  m_record_idx++;
+}
+
+void BinaryTraceReader::read(InstRecord& record) {
+  begin_record();
+  record.bubble_count = static_cast<int>(read_varint());
+  uint64_t head = read_varint();
+  record.load_addr = add_delta(m_prev_addr, unzigzag(head >> 1));
+  record.store_addr = (head & 1) ? add_delta(record.load_addr, read_svarint()) : -1;
+  m_prev_addr = record.load_addr;
+  m_record_idx++;
+}
+
+}  // namespace Ramulator
@@ -0,0 +1,204 @@
+#ifndef RAMULATOR_FRONTEND_TRACE_BINARY_TRACE_H
+#define RAMULATOR_FRONTEND_TRACE_BINARY_TRACE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ramulator/base/worker_pool.h"
+#include "ramulator/frontend/trace/mapped_file.h"
+#include "ramulator/frontend/trace/trace_record.h"
+#include "ramulator/frontend/trace/trace_stream.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    Compact binary trace format, written by `python -m ramulator trace convert`
+ *
+ * All integers are little-endian. The file is a header, the record blocks, then the block index:
+ *
+ *   Header (48 bytes)
+ *     char[8] magic          "RAMTRACE"
+ *     u32     version        1
+ *     u8      kind           BinaryTraceKind of every record
+ *     u8      addr_vec_size  Levels per address vector (ReadWrite), 0 otherwise
+ *     u16     reserved
+ *     u32     block_records  Records per block (the last block may hold fewer)
+ *     u32     reserved
+ *     u64     num_records
+ *     u64     num_blocks
+ *     u64     index_offset   File offset of the block index
+ *   Blocks, each starting from zeroed delta state so that it decodes on its own
+ *   Block index: num_blocks u64 file offsets, one per block
+ *
+ * Records are made of LEB128 varints; "svarint" is a zigzag-encoded signed varint:
+ *   LoadStore  varint(zigzag(addr - prev_addr) << 2 | op)  op: 0 LD, 1 ST, 2 ZR, 3 CP
+ *              [svarint(src_addr - addr)]                  CP only
+ *   ReadWrite  varint(zigzag(vec[0] - prev[0]) << 1 | is_write), then
+ *              svarint(vec[i] - prev[i]) for the remaining levels
+ *   Inst       varint(bubble_count), varint(zigzag(load - prev_load) << 1 | has_store),
+ *              [svarint(store - load)]                     has_store only
+ */
+enum class BinaryTraceKind : uint8_t {
+  LoadStore = 1,
+  ReadWrite = 2,
+  Inst = 3,
+};
+
+/**
+ * @brief    Decodes a binary trace from a memory-mapped file, record by record
+ */
+class BinaryTraceReader {
+ public:
+  static constexpr uint32_t VERSION = 1;
+
+  // Whether the file starts with the binary trace magic (anything else is read as text)
+  static bool is_binary_trace(const std::string& path);
+
+  // Opens the trace and validates its header and block index
+  explicit BinaryTraceReader(const std::string& path);
+
+  const std::string& path() const {
+    return m_file.path();
+  }
+  BinaryTraceKind kind() const {
+    return m_kind;
+  }
+  uint64_t num_records() const {
+    return m_num_records;
+  }
+  uint64_t num_blocks() const {
+    return m_block_offsets.size();
+  }
+  uint32_t block_records() const {
+    return m_block_records;
+  }
+
+  // Records left until the end of the trace
+  uint64_t num_remaining() const {
+    return m_num_records - m_record_idx;
+  }
+
+  // Position the reader at the first record of block
+  void seek_block(uint64_t block);
+
+  // Decode the next record (the trace must hold records of the matching kind and not be at its end)
+  void read(LoadStoreRecord& record);
+  void read(ReadWriteRecord& record);
+  void read(InstRecord& record);
+
+  // Decode the whole trace into records, spreading its blocks over up to num_threads threads
+  template <typename Record_t>
+  void read_all(std::vector<Record_t>& records, int num_threads = 1) {
+    expect_kind(kind_of(static_cast<Record_t*>(nullptr)));
+    records.resize(m_num_records);
+
+    int num_parts = static_cast<int>(std::clamp<uint64_t>(num_blocks(), 1, std::max(num_threads, 1)));
+    WorkerPool pool(num_parts);
+    pool.run(num_parts, [&](int part) {
+      // Each thread decodes a contiguous run of blocks with its own reader
+      uint64_t first_block = num_blocks() * part / num_parts;
+      uint64_t last_block = num_blocks() * (part + 1) / num_parts;
+      uint64_t begin = first_block * m_block_records;
+      uint64_t end = std::min<uint64_t>(last_block * m_block_records, m_num_records);
+
+      BinaryTraceReader reader(path());
+      reader.seek_block(first_block);
+      for (uint64_t i = begin; i < end; i++) {
+        reader.read(records[i]);
+      }
+    });
+  }
+
+  // Throw unless the trace holds records of kind
+  void expect_kind(BinaryTraceKind kind) const;
+
+  static constexpr BinaryTraceKind kind_of(const LoadStoreRecord*) {
+    return BinaryTraceKind::LoadStore;
+  }
+  static constexpr BinaryTraceKind kind_of(const ReadWriteRecord*) {
+    return BinaryTraceKind::ReadWrite;
+  }
+  static constexpr BinaryTraceKind kind_of(const InstRecord*) {
+    return BinaryTraceKind::Inst;
+  }
+
+ private:
+  // Drop consumed pages once this many bytes have been decoded past them
+  static constexpr size_t RELEASE_CHUNK_BYTES = 64 << 20;
+
+  MappedFile m_file;
+  BinaryTraceKind m_kind;
+  int m_addr_vec_size = 0;
+  uint32_t m_block_records = 0;
+  uint64_t m_num_records = 0;
+  std::vector<uint64_t> m_block_offsets;
+  uint64_t m_data_end = 0;  // Where the block index starts
+
+  const uint8_t* m_pos = nullptr;
+  const uint8_t* m_end = nullptr;
+  uint64_t m_record_idx = 0;
+  size_t m_released = 0;  // Pages before this offset have been released
+
+  // Delta state, reset at the start of every block
+  Addr_t m_prev_addr = 0;
+  AddrVec_t m_prev_addr_vec;
+
+  // Called before decoding each record: moves on to the next block and resets the delta state
+  // when the current block is done
+  void begin_record();
+  void corrupt(const char* what) const;
+
+  uint64_t read_varint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (m_pos == m_end) {
+        corrupt("truncated record");
+      }
+      uint8_t byte = *m_pos++;
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) {
+        return value;
+      }
+    }
+    corrupt("varint longer than 64 bits");
+    return 0;
+  }
+  static int64_t unzigzag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+  int64_t read_svarint() {
+    return unzigzag(read_varint());
+  }
+};
+
+/**
+ * @brief    Streams a binary trace into a TraceStream
+ */
+template <typename Record_t>
+class BinaryTraceSource : public ITraceSource<Record_t> {
+ public:
+  explicit BinaryTraceSource(const std::string& path) : m_reader(path) {
+    m_reader.expect_kind(BinaryTraceReader::kind_of(static_cast<Record_t*>(nullptr)));
+  }
+
+  size_t read(Record_t* records, size_t max_records) override {
+    size_t num_read = std::min<uint64_t>(max_records, m_reader.num_remaining());
+    for (size_t i = 0; i < num_read; i++) {
+      m_reader.read(records[i]);
+    }
+    return num_read;
+  }
+
+  void rewind() override {
+    m_reader.seek_block(0);
+  }
+
+ private:
+  BinaryTraceReader m_reader;
+};
+
+}  // namespace Ramulator
+
+#endif  // RAMULATOR_FRONTEND_TRACE_BINARY_TRACE_H
@@ -0,0 +1,46 @@
+#include "ramulator/frontend/trace/inst_trace.h"
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+#include <string_view>
+
+#include "ramulator/frontend/trace/binary_trace.h"
+#include "ramulator/frontend/trace/text_trace.h"
+
+namespace Ramulator {
+
+namespace {
+
+void parse_inst_line(const std::string& path, std::string_view line, size_t line_num, InstRecord& inst) {
+  std::string_view tokens[3];
+  size_t num_tokens = split_trace_fields(line, ' ', tokens, 3);
+  if (num_tokens != 2 && num_tokens != 3) {
+    throw std::runtime_error(
+        fmt::format("Trace {} line {}: expected 2 or 3 tokens, got {}", path, line_num, num_tokens));
+  }
+
+  bool valid = parse_trace_int(tokens[0], inst.bubble_count) && parse_trace_int(tokens[1], inst.load_addr);
+  inst.store_addr = -1;
+  if (num_tokens == 3) {
+    valid = valid && parse_trace_int(tokens[2], inst.store_addr);
+  }
+  if (!valid) {
+    throw std::runtime_error(fmt::format("Trace {} line {}: invalid instruction '{}'", path, line_num, line));
+  }
+}
+
+}  // namespace
+
+void load_inst_trace(const std::string& path, std::vector<InstRecord>& records, int num_threads) {
+  if (BinaryTraceReader::is_binary_trace(path)) {
+    BinaryTraceReader(path).read_all(records, num_threads);
+    return;
+  }
+  parse_text_trace<InstRecord>(
+      path,
+      [&path](std::string_view line, size_t line_num, InstRecord& inst) { parse_inst_line(path, line, line_num, inst); },
+      records, num_threads);
+}
+
+}  // namespace Ramulator
@@ -0,0 +1,21 @@
+#ifndef RAMULATOR_FRONTEND_TRACE_INST_TRACE_H
+#define RAMULATOR_FRONTEND_TRACE_INST_TRACE_H
+
+#include <string>
+#include <vector>
+
+#include "ramulator/frontend/trace/trace_record.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    Load a whole processor (SimpleO3/BHO3) trace, text or binary, on up to num_threads threads
+ *
+ * Text format: one instruction per line, space-separated.
+ *   <bubble_count> <load_addr> [store_addr]
+ */
+void load_inst_trace(const std::string& path, std::vector<InstRecord>& records, int num_threads);
+
+}  // namespace Ramulator
+
+#endif  // RAMULATOR_FRONTEND_TRACE_INST_TRACE_H
@@ -0,0 +1,69 @@
+#include "ramulator/frontend/trace/mapped_file.h"
+
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+namespace Ramulator {
+
+MappedFile::MappedFile(const std::string& path) : m_path(path) {
+  if (!std::filesystem::exists(path)) {
+    throw std::runtime_error(fmt::format("Trace {} does not exist!", path));
+  }
+
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error(fmt::format("Trace {} cannot be opened! ({})", path, std::strerror(errno)));
+  }
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    int err = errno;
+    ::close(fd);
+    throw std::runtime_error(fmt::format("Trace {} cannot be opened! ({})", path, std::strerror(err)));
+  }
+  m_size = static_cast<size_t>(st.st_size);
+
+  // mmap() rejects empty mappings; an empty file simply has no data
+  if (m_size > 0) {
+    void* addr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+      int err = errno;
+      ::close(fd);
+      throw std::runtime_error(fmt::format("Trace {} cannot be mapped! ({})", path, std::strerror(err)));
+    }
+    m_data = static_cast<const char*>(addr);
+    ::madvise(addr, m_size, MADV_SEQUENTIAL);
+  }
+
+  // The mapping stays valid after the descriptor is closed
+  ::close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (m_data) {
+    ::munmap(const_cast<char*>(m_data), m_size);
+  }
+}
+
+void MappedFile::release(size_t begin, size_t end) {
+  static const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+
+  end = std::min(end, m_size);
+  size_t first = begin / page_size * page_size;
+  size_t last = (end == m_size) ? end : end / page_size * page_size;
+  if (!m_data || first >= last) {
+    return;
+  }
+  ::madvise(const_cast<char*>(m_data) + first, last - first, MADV_DONTNEED);
+}
+
+}  // namespace Ramulator
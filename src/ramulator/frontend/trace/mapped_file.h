@@ -0,0 +1,46 @@
+#ifndef RAMULATOR_FRONTEND_TRACE_MAPPED_FILE_H
+#define RAMULATOR_FRONTEND_TRACE_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace Ramulator {
+
+/**
+ * @brief    Read-only memory mapping of a whole file
+ *
+ * Pages are only read from disk when first touched, so opening a file of any size is instant.
+ * Readers that stream through the file release() the ranges they are done with, which keeps
+ * the resident set bounded regardless of the file size.
+ */
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& path);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const char* data() const {
+    return m_data;
+  }
+  size_t size() const {
+    return m_size;
+  }
+  const std::string& path() const {
+    return m_path;
+  }
+
+  // Drop the resident pages of [begin, end), for a reader that is done with everything before
+  // end. The page holding end is kept. Dropped pages are re-read from the file if touched again.
+  void release(size_t begin, size_t end);
+
+ private:
+  std::string m_path;
+  const char* m_data = nullptr;
+  size_t m_size = 0;
+};
+
+}  // namespace Ramulator
+
+#endif  // RAMULATOR_FRONTEND_TRACE_MAPPED_FILE_H
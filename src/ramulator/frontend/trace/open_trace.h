@@ -0,0 +1,35 @@
+#ifndef RAMULATOR_FRONTEND_TRACE_OPEN_TRACE_H
+#define RAMULATOR_FRONTEND_TRACE_OPEN_TRACE_H
+
+#include <memory>
+#include <string>
+
+#include "ramulator/frontend/trace/binary_trace.h"
+#include "ramulator/frontend/trace/text_trace.h"
+#include "ramulator/frontend/trace/trace_stream.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    Open a trace for streaming, cyclic replay
+ *
+ * Binary traces are recognized by their magic; any other file is parsed as text with parse.
+ * With prefetch, the trace is decoded ahead on a background thread (parse must then be safe to
+ * call from that thread).
+ */
+template <typename Record_t>
+std::unique_ptr<TraceStream<Record_t>> open_trace_stream(const std::string& path,
+                                                         typename TextTraceSource<Record_t>::ParseFn parse,
+                                                         bool prefetch = false) {
+  std::unique_ptr<ITraceSource<Record_t>> source;
+  if (BinaryTraceReader::is_binary_trace(path)) {
+    source = std::make_unique<BinaryTraceSource<Record_t>>(path);
+  } else {
+    source = std::make_unique<TextTraceSource<Record_t>>(path, std::move(parse));
+  }
+  return std::make_unique<TraceStream<Record_t>>(std::move(source), prefetch);
+}
+
+}  // namespace Ramulator
+
+#endif  // RAMULATOR_FRONTEND_TRACE_OPEN_TRACE_H
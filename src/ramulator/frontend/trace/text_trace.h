@@ -0,0 +1,185 @@
+#ifndef RAMULATOR_FRONTEND_TRACE_TEXT_TRACE_H
+#define RAMULATOR_FRONTEND_TRACE_TEXT_TRACE_H
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ramulator/base/worker_pool.h"
+#include "ramulator/frontend/trace/mapped_file.h"
+#include "ramulator/frontend/trace/trace_stream.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    Split line at every delim into fields (as tokenize() does, but without allocating)
+ *
+ * Stores at most max_fields fields and returns how many the line has, which may be more.
+ */
+inline size_t split_trace_fields(std::string_view line, char delim, std::string_view* fields, size_t max_fields) {
+  size_t num_fields = 0;
+  size_t pos = 0;
+  while (true) {
+    size_t next = line.find(delim, pos);
+    std::string_view field = line.substr(pos, next == std::string_view::npos ? std::string_view::npos : next - pos);
+    if (num_fields < max_fields) {
+      fields[num_fields] = field;
+    }
+    num_fields++;
+    if (next == std::string_view::npos) {
+      return num_fields;
+    }
+    pos = next + 1;
+  }
+}
+
+/**
+ * @brief    Parse a whole field as a decimal or 0x-prefixed hexadecimal integer
+ *
+ * Returns false unless the entire field is a valid number of Int_t.
+ */
+template <typename Int_t>
+bool parse_trace_int(std::string_view field, Int_t& value) {
+  int base = 10;
+  if (field.size() > 2 && field[0] == '0' && (field[1] == 'x' || field[1] == 'X')) {
+    field.remove_prefix(2);
+    base = 16;
+  }
+  const char* end = field.data() + field.size();
+  auto [ptr, ec] = std::from_chars(field.data(), end, value, base);
+  return ec == std::errc() && ptr == end && !field.empty();
+}
+
+/**
+ * @brief    Decodes a line-based text trace from a memory-mapped file
+ *
+ * parse(line, line_num, record) fills a record in place from one line (without the line
+ * terminator) and throws std::runtime_error on malformed input. Pages behind the cursor are
+ * released as parsing advances, so the resident set stays bounded.
+ */
+template <typename Record_t>
+class TextTraceSource : public ITraceSource<Record_t> {
+ public:
+  using ParseFn = std::function<void(std::string_view line, size_t line_num, Record_t& record)>;
+
+  TextTraceSource(const std::string& path, ParseFn parse) : m_file(path), m_parse(std::move(parse)) {
+  }
+
+  size_t read(Record_t* records, size_t max_records) override {
+    const char* data = m_file.data();
+    size_t size = m_file.size();
+
+    size_t num_read = 0;
+    while (num_read < max_records && m_cursor < size) {
+      const char* line_begin = data + m_cursor;
+      const char* line_end = static_cast<const char*>(std::memchr(line_begin, '\n', size - m_cursor));
+      if (!line_end) {
+        line_end = data + size;
+      }
+      m_cursor = line_end - data + 1;
+
+      std::string_view line(line_begin, line_end - line_begin);
+      if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+      }
+      m_parse(line, ++m_line_num, records[num_read++]);
+    }
+
+    if (m_cursor - m_released >= RELEASE_CHUNK_BYTES) {
+      m_file.release(m_released, m_cursor);
+      m_released = m_cursor;
+    }
+    return num_read;
+  }
+
+  void rewind() override {
+    m_file.release(m_released, m_file.size());
+    m_cursor = 0;
+    m_line_num = 0;
+    m_released = 0;
+  }
+
+ private:
+  // Drop consumed pages once this many bytes have been parsed past them
+  static constexpr size_t RELEASE_CHUNK_BYTES = 64 << 20;
+
+  MappedFile m_file;
+  ParseFn m_parse;
+
+  size_t m_cursor = 0;  // Byte offset of the next line to decode
+  size_t m_line_num = 0;
+  size_t m_released = 0;  // Pages before this offset have been released
+};
+
+/**
+ * @brief    Parse a whole text trace into records on up to num_threads threads
+ *
+ * The file is split into byte ranges aligned on line boundaries. The lines of every range are
+ * counted first, so each range is then parsed straight into its final slots: records keep the
+ * file order, and errors report the right line number (the first malformed line is reported).
+ * parse is called concurrently from several threads.
+ */
+template <typename Record_t>
+void parse_text_trace(const std::string& path, const typename TextTraceSource<Record_t>::ParseFn& parse,
+                      std::vector<Record_t>& records, int num_threads) {
+  // Ranges smaller than this are not worth a thread
+  static constexpr size_t MIN_RANGE_BYTES = 1 << 20;
+
+  MappedFile file(path);
+  const char* data = file.data();
+  size_t size = file.size();
+
+  size_t num_ranges = std::clamp<size_t>(size / MIN_RANGE_BYTES, 1, std::max(num_threads, 1));
+  std::vector<size_t> range_begin(num_ranges + 1, size);
+  range_begin[0] = 0;
+  for (size_t i = 1; i < num_ranges; i++) {
+    // Start each range right after the first line break at or past its nominal start
+    size_t begin = std::max(size / num_ranges * i, range_begin[i - 1]);
+    const char* brk = begin < size ? static_cast<const char*>(std::memchr(data + begin, '\n', size - begin)) : nullptr;
+    range_begin[i] = brk ? brk - data + 1 : size;
+  }
+
+  WorkerPool pool(static_cast<int>(num_ranges));
+
+  std::vector<size_t> first_line(num_ranges + 1, 0);
+  pool.run(static_cast<int>(num_ranges), [&](int i) {
+    size_t begin = range_begin[i];
+    size_t end = range_begin[i + 1];
+    size_t num_lines = std::count(data + begin, data + end, '\n');
+    if (end == size && end > begin && data[end - 1] != '\n') {
+      num_lines++;  // Last line without a line break
+    }
+    first_line[i + 1] = num_lines;
+  });
+  for (size_t i = 0; i < num_ranges; i++) {
+    first_line[i + 1] += first_line[i];
+  }
+
+  records.resize(first_line[num_ranges]);
+  pool.run(static_cast<int>(num_ranges), [&](int i) {
+    size_t cursor = range_begin[i];
+    size_t end = range_begin[i + 1];
+    for (size_t line_idx = first_line[i]; cursor < end; line_idx++) {
+      const char* line_begin = data + cursor;
+      const char* line_end = static_cast<const char*>(std::memchr(line_begin, '\n', end - cursor));
+      if (!line_end) {
+        line_end = data + end;
+      }
+      cursor = line_end - data + 1;
+
+      std::string_view line(line_begin, line_end - line_begin);
+      if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+      }
+      parse(line, line_idx + 1, records[line_idx]);
+    }
+  });
+}
+
+}  // namespace Ramulator
+
+#endif  // RAMULATOR_FRONTEND_TRACE_TEXT_TRACE_H
@@ -0,0 +1,40 @@
+#ifndef RAMULATOR_FRONTEND_TRACE_TRACE_RECORD_H
+#define RAMULATOR_FRONTEND_TRACE_TRACE_RECORD_H
+
+#include "ramulator/base/request.h"
+#include "ramulator/base/type.h"
+
+namespace Ramulator {
+
+// One request of a LoadStoreTrace (flat addresses)
+struct LoadStoreRecord {
+  int type_id = Request::Type::Read;
+  Addr_t addr = 0;
+  Addr_t src_addr = -1;  // Copy only
+};
+
+// One request of a ReadWriteTrace (address vectors)
+struct ReadWriteRecord {
+  bool is_write = false;
+  AddrVec_t addr_vec;
+};
+
+// One memory instruction of a processor (SimpleO3/BHO3) trace, after bubble_count non-memory ones
+struct InstRecord {
+  int bubble_count = 0;
+  Addr_t load_addr = -1;
+  Addr_t store_addr = -1;
+};
+
+// One request of a TimestampedTrace, injected at timestamp (in the trace's time unit)
+struct TimedRecord {
+  double timestamp = 0;
+  int type_id = Request::Type::Read;
+  Addr_t addr = 0;
+  int size_bytes = -1;  // -1: one memory system transaction
+  int source_id = 0;
+};
+
+}  // namespace Ramulator
+
+#endif  // RAMULATOR_FRONTEND_TRACE_TRACE_RECORD_H
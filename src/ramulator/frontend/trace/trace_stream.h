@@ -0,0 +1,187 @@
+#ifndef RAMULATOR_FRONTEND_TRACE_TRACE_STREAM_H
+#define RAMULATOR_FRONTEND_TRACE_TRACE_STREAM_H
+
+#include <exception>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ramulator/base/spsc_queue.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    Sequential decoder of one trace file
+ */
+template <typename Record_t>
+class ITraceSource {
+ public:
+  virtual ~ITraceSource() = default;
+
+  // Decode up to max_records of the next records into records. Returns fewer only once the end
+  // of the file is reached (0 if already there).
+  virtual size_t read(Record_t* records, size_t max_records) = 0;
+
+  // Go back to the first record
+  virtual void rewind() = 0;
+};
+
+/**
+ * @brief    Replays a trace cyclically, decoding it lazily one block of records at a time
+ *
+ * Memory use does not grow with the trace size. Consuming the last record wraps around to the
+ * first one. Records are reused between blocks, so sources decode into them without allocating.
+ *
+ * With prefetch, a background thread decodes the next block into a second buffer while the
+ * current one is replayed, so trace I/O and decoding overlap with the simulation. Filled and
+ * consumed blocks are handed over through lock-free queues, and a decoding error is rethrown on
+ * the replaying thread once it reaches the failed block.
+ */
+template <typename Record_t>
+class TraceStream {
+ public:
+  static constexpr size_t UNKNOWN_LENGTH = std::numeric_limits<size_t>::max();
+
+  explicit TraceStream(std::unique_ptr<ITraceSource<Record_t>> source, bool prefetch = false,
+                       size_t block_size = 4096)
+      : m_source(std::move(source)) {
+    for (auto& block : m_blocks) {
+      block.records.resize(block_size);
+    }
+
+    if (!prefetch) {
+      m_current = &m_blocks[0];
+      fill_block(*m_current);
+    } else {
+      for (auto& block : m_blocks) {
+        m_free.push(&block);
+      }
+      m_prefetcher = std::thread([this] { prefetch_loop(); });
+      try {
+        next_prefetched_block();
+      } catch (...) {
+        // The destructor does not run: stop the prefetcher here
+        stop_prefetcher();
+        throw;
+      }
+    }
+    m_length = m_current->length;
+  }
+
+  ~TraceStream() {
+    stop_prefetcher();
+  }
+
+  TraceStream(const TraceStream&) = delete;
+  TraceStream& operator=(const TraceStream&) = delete;
+
+  // Records in one pass over the trace; UNKNOWN_LENGTH until the first pass has been decoded
+  size_t length() const {
+    return m_length;
+  }
+
+  bool empty() const {
+    return m_length == 0;
+  }
+
+  // The next record to replay (the trace must not be empty)
+  const Record_t& front() const {
+    return m_current->records[m_block_pos];
+  }
+
+  void pop() {
+    if (++m_block_pos == m_current->size) {
+      if (m_prefetcher.joinable()) {
+        m_free.push(m_current);
+        next_prefetched_block();
+      } else {
+        fill_block(*m_current);
+      }
+      m_length = m_current->length;
+      m_block_pos = 0;
+    }
+  }
+
+ private:
+  struct Block {
+    std::vector<Record_t> records;
+    size_t size = 0;                 // Decoded records
+    size_t length = UNKNOWN_LENGTH;  // Trace length as known once this block was decoded
+    std::exception_ptr error;        // Set if decoding failed
+  };
+
+  std::unique_ptr<ITraceSource<Record_t>> m_source;
+
+  // Replaying side
+  Block m_blocks[2];
+  Block* m_current = nullptr;
+  size_t m_block_pos = 0;
+  size_t m_length = UNKNOWN_LENGTH;
+
+  // Decoding side (the prefetcher thread with prefetch, the replaying thread otherwise)
+  size_t m_num_decoded = 0;  // Records decoded during the first pass
+  size_t m_source_length = UNKNOWN_LENGTH;
+
+  // Free blocks (nullptr asks the prefetcher to stop) and decoded blocks, in replay order
+  SpscQueue<Block*, 4> m_free;
+  SpscQueue<Block*, 4> m_filled;
+  std::thread m_prefetcher;
+
+  void fill_block(Block& block) {
+    block.size = 0;
+    while (block.size < block.records.size()) {
+      size_t num_read = m_source->read(&block.records[block.size], block.records.size() - block.size);
+      block.size += num_read;
+      if (m_source_length == UNKNOWN_LENGTH) {
+        m_num_decoded += num_read;
+      }
+      if (block.size == block.records.size()) {
+        break;
+      }
+
+      // End of the file: wrap around
+      if (m_source_length == UNKNOWN_LENGTH) {
+        m_source_length = m_num_decoded;
+      }
+      if (m_source_length == 0) {
+        break;
+      }
+      m_source->rewind();
+    }
+    block.length = m_source_length;
+  }
+
+  void prefetch_loop() {
+    while (Block* block = m_free.pop()) {
+      try {
+        fill_block(*block);
+      } catch (...) {
+        block->error = std::current_exception();
+      }
+      bool done = block->error || block->length == 0;
+      m_filled.push(block);
+      if (done) {
+        return;  // Nothing more to decode
+      }
+    }
+  }
+
+  void stop_prefetcher() {
+    if (m_prefetcher.joinable()) {
+      m_free.push(nullptr);
+      m_prefetcher.join();
+    }
+  }
+
+  void next_prefetched_block() {
+    m_current = m_filled.pop();
+    if (m_current->error) {
+      std::rethrow_exception(m_current->error);
+    }
+  }
+};
+
+}  // namespace Ramulator
+
+#endif  // RAMULATOR_FRONTEND_TRACE_TRACE_STREAM_H
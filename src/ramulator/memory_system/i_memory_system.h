@@ -56,6 +56,15 @@ class IMemorySystem : public TopLevel<IMemorySystem> {
   virtual bool send(Request& req) = 0;
   virtual void tick() = 0;
 
+  // Idle fast-forward: number of upcoming tick() calls that are known to be no-ops as long as
+  // no new request is sent (CLK_NEVER if there is no pending event at all), and a way to skip
+  // them. The defaults disable skipping.
+  virtual Clk_t get_num_idle_ticks() {
+    return 0;
+  }
+  virtual void skip_idle_ticks(Clk_t num_ticks) {
+  }
+
   // Returns the clock ratio for the memory system (forwarded from controllers).
   virtual int get_clock_ratio() = 0;
 
@@ -1,8 +1,12 @@
+#include <algorithm>
+#include <memory>
 #include <stdexcept>
+#include <thread>
 
 #include <fmt/format.h>
 
 #include "ramulator/base/param.h"
+#include "ramulator/base/worker_pool.h"
 #include "ramulator/controller/i_controller.h"
 #include "ramulator/memory_system/channel_mapper/i_channel_mapper.h"
 #include "ramulator/memory_system/i_memory_system.h"
@@ -18,6 +22,14 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
   std::vector<IController*> m_controllers;
   unsigned int m_clock_ratio = 1;
   int m_tx_bytes = 0;
+  bool m_fast_forward = false;
+  Clk_t m_num_idle_ticks = -1;  // Cached get_num_idle_ticks(), -1 once a tick or send invalidates it
+  // Busy phases rarely have idle ticks: after a "no idle ticks" answer, wait this many
+  // (exponentially growing) memory ticks before scanning the controllers again.
+  int m_idle_check_backoff = 0;
+  int m_idle_check_countdown = 0;
+  int m_num_threads = 1;
+  std::unique_ptr<WorkerPool> m_pool;  // Only created when channels tick in parallel
 
  public:
   int s_num_read_requests = 0;
@@ -26,6 +38,8 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
  public:
   void init() override {
     RAMULATOR_PARSE_PARAM(m_clock_ratio, unsigned int, "clock_ratio").required();
+    // Skip ticks on which no controller can make progress (results are unchanged)
+    RAMULATOR_PARSE_PARAM(m_fast_forward, bool, "fast_forward").default_val(false);
     RAMULATOR_CREATE_CHILD(m_channel_mapper, IChannelMapper);
 
     // Each controller = one channel. DRAM config lives inside each controller.
@@ -43,8 +57,34 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
     m_tx_bytes = m_controllers[0]->get_tx_bytes();
     m_channel_mapper->setup(static_cast<int>(m_controllers.size()), calc_log2(m_tx_bytes));
 
+    // Tick channels on a worker pool (results are unchanged)
+    RAMULATOR_PARSE_PARAM(m_num_threads, int, "num_threads").default_val(1);
+    if (m_num_threads < 1) {
+      throw std::runtime_error(fmt::format("GenericDRAM num_threads must be >= 1 (got {})", m_num_threads));
+    }
+    m_num_threads = std::min(m_num_threads, static_cast<int>(m_controllers.size()));
+    // Workers spin between ticks, so oversubscribing the host slows the run down (results are unchanged).
+    int num_cores = static_cast<int>(std::thread::hardware_concurrency());
+    if (num_cores > 0 && m_num_threads > num_cores) {
+      m_logger.warn(fmt::format("GenericDRAM num_threads = {} exceeds the {} hardware threads of this host.",
+                                m_num_threads, num_cores));
+    }
+    if (m_num_threads > 1) {
+      for (auto controller : m_controllers) {
+        if (!controller->supports_parallel_tick()) {
+          throw std::runtime_error(fmt::format(
+              "Controller {} does not support parallel ticking; set GenericDRAM num_threads to 1.",
+              dynamic_cast<Implementation*>(controller)->get_name()));
+        }
+        // Callbacks reach the frontend, so they are replayed serially in channel order.
+        controller->set_defer_callbacks(true);
+      }
+      m_pool = std::make_unique<WorkerPool>(m_num_threads);
+    }
+
     m_stats.add("total_num_read_requests", s_num_read_requests);
     m_stats.add("total_num_write_requests", s_num_write_requests);
+    m_stats.add("num_threads", m_num_threads);
   };
 
   void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
@@ -62,9 +102,20 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
     // Controller::send() handles address mapping internally.
     m_channel_mapper->apply(req);
     int channel_id = req.addr_vec[0];
+    if (req.type_id == Request::Type::Copy) {
+      // RowClone copies stay inside one DRAM chip, so the source must share the channel
+      Request src(req.src_addr, req.type_id);
+      m_channel_mapper->apply(src);
+      if (src.addr_vec[0] != channel_id) {
+        throw std::runtime_error(fmt::format("Copy request from {:#x} to {:#x} crosses channels ({} -> {})",
+                                             req.src_addr, req.addr, src.addr_vec[0], channel_id));
+      }
+      req.src_intra_channel_addr = src.intra_channel_addr;
+    }
     bool is_success = m_controllers[channel_id]->send(req);
 
     if (is_success) {
+      m_num_idle_ticks = -1;
       switch (req.type_id) {
         case Request::Type::Read: {
           s_num_read_requests++;
@@ -80,11 +131,65 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
   };
 
   void tick() override {
+    m_num_idle_ticks = -1;
+    if (m_idle_check_countdown > 0) {
+      m_idle_check_countdown--;
+    }
+    if (!m_pool) {
+      for (auto controller : m_controllers) {
+        controller->tick();
+      }
+      return;
+    }
+    // Channels share no DRAM state, so their ticks are independent. Replaying the callbacks
+    // afterwards in channel order reproduces the frontend-visible order of the serial loop.
+    m_pool->run(static_cast<int>(m_controllers.size()), [this](int i) { m_controllers[i]->tick(); });
     for (auto controller : m_controllers) {
-      controller->tick();
+      controller->run_deferred_callbacks();
     }
   };
 
+  Clk_t get_num_idle_ticks() override {
+    if (!m_fast_forward) {
+      return 0;
+    }
+    // The frontend may ask several times between two memory ticks; nothing changes meanwhile
+    // unless a request is accepted.
+    if (m_num_idle_ticks >= 0) {
+      return m_num_idle_ticks;
+    }
+    if (m_idle_check_countdown > 0) {
+      return 0;
+    }
+    // All controllers share one clock, so the earliest event across channels bounds the skip.
+    Clk_t num_idle = CLK_NEVER;
+    for (auto controller : m_controllers) {
+      Clk_t next = controller->get_next_event_clk();
+      if (next == CLK_NEVER) {
+        continue;
+      }
+      num_idle = std::min(num_idle, next - controller->m_clk - 1);
+      if (num_idle == 0) {
+        break;
+      }
+    }
+    if (num_idle == 0) {
+      m_idle_check_backoff = std::min(std::max(2 * m_idle_check_backoff, 1), 64);
+      m_idle_check_countdown = m_idle_check_backoff;
+    } else {
+      m_idle_check_backoff = 0;
+    }
+    m_num_idle_ticks = num_idle;
+    return num_idle;
+  }
+
+  void skip_idle_ticks(Clk_t num_ticks) override {
+    m_num_idle_ticks = -1;
+    for (auto controller : m_controllers) {
+      controller->fast_forward(num_ticks);
+    }
+  }
+
   void reset_stats() override {
     s_num_read_requests = 0;
     s_num_write_requests = 0;
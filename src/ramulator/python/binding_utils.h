@@ -11,8 +11,28 @@
 #include <string>
 
 #include "ramulator/base/config_node.h"
+#include "ramulator/base/type.h"
 #include "ramulator/dram/dram_spec.h"
 
+// AddrVec_t <-> list[int], reusing nanobind's list caster. Sequences longer than the
+// inline capacity are rejected as a type mismatch instead of throwing inside the caster.
+NAMESPACE_BEGIN(NB_NAMESPACE)
+NAMESPACE_BEGIN(detail)
+template <>
+struct type_caster<Ramulator::AddrVec> : list_caster<Ramulator::AddrVec, int> {
+  bool from_python(handle src, uint8_t flags, cleanup_list* cleanup) noexcept {
+    Py_ssize_t size = PySequence_Check(src.ptr()) ? PySequence_Size(src.ptr()) : -1;
+    if (size < 0) {
+      PyErr_Clear();
+    } else if (size > Ramulator::AddrVec::kCapacity) {
+      return false;
+    }
+    return list_caster<Ramulator::AddrVec, int>::from_python(src, flags, cleanup);
+  }
+};
+NAMESPACE_END(detail)
+NAMESPACE_END(NB_NAMESPACE)
+
 namespace nb = nanobind;
 
 using namespace Ramulator;
@@ -1,6 +1,7 @@
 #include <nanobind/nanobind.h>
 #include <nanobind/stl/string.h>
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -22,6 +23,31 @@ class Simulation {
     m_memory_system->update_stats_recursive();
   }
 
+  // Called right after the frontend ticked at iteration t (before the memory system's tick, if
+  // any). If both sides report upcoming idle ticks, skips every tick before the first iteration
+  // where either side has work and returns that iteration; otherwise returns t.
+  Clk_t skip_idle_iterations(Clk_t t, int fe_tick, int mem_tick) {
+    Clk_t fe_idle = m_frontend->get_num_idle_ticks();
+    if (fe_idle == 0) {
+      return t;
+    }
+    Clk_t mem_idle = m_memory_system->get_num_idle_ticks();
+    if (mem_idle == 0 || (fe_idle == CLK_NEVER && mem_idle == CLK_NEVER)) {
+      return t;
+    }
+
+    auto ceil_div = [](Clk_t a, Clk_t b) { return (a + b - 1) / b; };
+    Clk_t first_mem_iter = ceil_div(t, fe_tick) * fe_tick;
+    Clk_t fe_busy_iter = (fe_idle == CLK_NEVER) ? CLK_NEVER : t + mem_tick * (fe_idle + 1);
+    Clk_t mem_busy_iter = (mem_idle == CLK_NEVER) ? CLK_NEVER : first_mem_iter + fe_tick * mem_idle;
+    Clk_t resume = std::min(fe_busy_iter, mem_busy_iter);
+
+    // Frontend ticks in (t, resume), memory ticks in [t, resume)
+    m_frontend->skip_idle_ticks(ceil_div(resume, mem_tick) - t / mem_tick - 1);
+    m_memory_system->skip_idle_ticks(ceil_div(resume, fe_tick) - ceil_div(t, fe_tick));
+    return resume;
+  }
+
  public:
   explicit Simulation(nb::dict config) {
     ConfigNode cfg = py_to_confignode(config);
@@ -50,19 +76,28 @@ class Simulation {
       throw std::runtime_error("clock_ratio must be > 0 for both frontend and memory system");
     }
 
-    int fe_count = mem_tick - 1, mem_count = fe_tick - 1;
-    for (;;) {
-      if (++fe_count >= mem_tick) {
-        fe_count = 0;
+    // Iteration t ticks the frontend when t % mem_tick == 0 and the memory system when
+    // t % fe_tick == 0, so both advance at their relative clock ratios.
+    for (Clk_t t = 0;; t++) {
+      bool fe_ticked = false;
+      if (t % mem_tick == 0) {
         m_frontend->tick();
+        fe_ticked = true;
       }
 
       if (m_frontend->is_finished()) {
         break;
       }
 
-      if (++mem_count >= fe_tick) {
-        mem_count = 0;
+      if (fe_ticked) {
+        Clk_t resume = skip_idle_iterations(t, fe_tick, mem_tick);
+        if (resume > t) {
+          t = resume - 1;
+          continue;
+        }
+      }
+
+      if (t % fe_tick == 0) {
         m_memory_system->tick();
       }
     }
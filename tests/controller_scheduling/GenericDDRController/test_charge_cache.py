@@ -0,0 +1,39 @@
+import pytest
+
+import ramulator
+import tests.controller_scheduling.harness as cs
+
+pytestmark = pytest.mark.controller_scheduling
+
+
+def make_dut(**charge_cache_kwargs):
+    dram = ramulator.dram.DDR4(org_preset="DDR4_8Gb_x8", timing_preset="DDR4_2400R", rank=1)
+    return cs.ControllerUnderTest.make_generic_ddr(
+        dram,
+        controller_plugins=[ramulator.controller_plugin.ChargeCache(**charge_cache_kwargs)],
+    )
+
+
+def test_reactivated_row_opens_with_reduced_nrcd_and_nras():
+    dut = make_dut(rcd_reduction_ns=5.0, ras_reduction_ns=10.0)
+    tCK_ns = dut.timings["tCK_ps"] / 1000.0
+    rcd_reduction = int(5.0 / tCK_ns)
+    ras_reduction = int(10.0 / tCK_ns)
+    row0 = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=0, Column=0)
+    row1 = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=1, Column=0)
+
+    history = []
+    for batch in ([row0], [row1], [row0, row1]):
+        for addr in batch:
+            dut.send_request("Read", addr)
+        history += dut.run_until_idle(max_ticks=512)
+
+    dut.assert_commands(
+        ["ACT", "RD", "PREpb", "ACT", "RD", "PREpb", "ACT", "RD", "PREpb", "ACT", "RD"], history=history
+    )
+    # First activations of both rows miss in the HCRAC
+    dut.assert_gap(0, 1, dut.timings["nRCD"], history=history)
+    dut.assert_gap(3, 4, dut.timings["nRCD"], history=history)
+    # Row 0 is still highly charged when reopened
+    dut.assert_gap(6, 7, dut.timings["nRCD"] - rcd_reduction, history=history)
+    dut.assert_gap(6, 8, dut.timings["nRAS"] - ras_reduction, history=history)
@@ -123,6 +123,57 @@ def test_closedcap_upgrades_second_access_to_rda():
     dut.assert_commands(["ACT", "RD", "RDA"], history=history)
 
 
+def test_reactivated_active_request_does_not_hold_back_precharge():
+    dut = make_dut(row_policy=ramulator.row_policy.ClosedCAP(cap=2))
+    bank_group = dut.level_names.index("BankGroup")
+
+    # A write to another bank group, whose WR-to-RD turnaround holds back the read below
+    dut.send_request("Write", dut.addr_vec(Rank=0, BankGroup=1, Bank=0, Row=3, Column=0))
+    while not dut.history:
+        dut.tick()
+    for _ in range(10):
+        dut.tick()
+
+    # The read activates row 5 and becomes active, but the row-hit writes go first and the third
+    # one is upgraded to WRA, closing the row under the read, which then activates it again
+    dut.send_request("Read", dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=5, Column=0))
+    for column in (8, 16, 24):
+        dut.send_request("Write", dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=5, Column=column))
+    history = dut.run_until_idle(max_ticks=512)
+    bank0 = [item.command for item in history if item.addr_vec[bank_group] == 0]
+    assert bank0 == ["ACT", "WR", "WR", "WRA", "ACT", "RD"]
+
+    # With the re-activated read retired, a row conflict on its bank precharges right away,
+    # while a read to another bank is still active
+    dut.send_request("Read", dut.addr_vec(Rank=0, BankGroup=2, Bank=0, Row=1, Column=0))
+    dut.send_request("Read", dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=6, Column=0))
+    history = dut.run_until_idle(max_ticks=512)
+    dut.assert_commands(["ACT", "PREpb", "RD", "ACT", "RD"], history=history)
+
+
+def test_forwarded_read_completes_ahead_of_earlier_read():
+    dut = make_dut()
+    x = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=0, Column=0)
+    a = dut.addr_vec(Rank=0, BankGroup=1, Bank=0, Row=0, Column=0)
+
+    dut.send_request("Read", x)
+    while not any(item.command == "RD" for item in dut.history):
+        dut.tick()
+
+    # Served from the write buffer: departs next cycle, while x is still in flight.
+    dut.send_request("Write", a)
+    dut.send_request("Read", a)
+    assert dut.pending_read_completions() == 2
+
+    dut.tick()
+    assert dut.pending_read_completions() == 1
+    assert dut.completed_reads() == [a]
+
+    dut.run_until_idle(max_ticks=128)
+    assert dut.pending_read_completions() == 0
+    assert dut.completed_reads() == [a, x]
+
+
 def test_priority_send_tracks_maintenance_stats():
     dut = make_dut()
     refresh = dut.addr_vec(Rank=0, BankGroup=dut.ALL, Bank=dut.ALL, Row=dut.ALL, Column=0)
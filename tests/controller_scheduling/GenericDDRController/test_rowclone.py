@@ -0,0 +1,75 @@
+import pytest
+
+import ramulator
+import tests.controller_scheduling.harness as cs
+
+pytestmark = pytest.mark.controller_scheduling
+
+
+def make_dut():
+    dram = ramulator.dram.DDR4_RowClone(org_preset="DDR4_8Gb_x8", timing_preset="DDR4_2400R", rank=1)
+    return cs.ControllerUnderTest.make_generic_ddr(dram)
+
+
+def test_init_precharges_open_bank_then_issues_fpm_copy():
+    dut = make_dut()
+    row0 = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=0, Column=0)
+    row5 = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=5, Column=0)
+
+    dut.send_request("Read", row0)
+    history = dut.run_until_idle(max_ticks=256)
+    dut.send_request("Init", row5)
+    history += dut.run_until_idle(max_ticks=512)
+
+    dut.assert_commands(["ACT", "RD", "PREpb", "RCFPM"], history=history)
+    dut.assert_gap(2, 3, dut.timings["nRP"], history=history)
+
+    # The copy completes nFPM after RCFPM issues
+    for _ in range(dut.timings["nFPM"] + 1):
+        dut.tick()
+    assert dut.stats()["num_copy_reqs_served"] == 1
+
+
+def _row_addr(rank=0, bank_group=0, bank=0, row=0):
+    """Intra-channel address of a row under RoBaRaCoCh (DDR4_8Gb_x8, rank=1, 64B transactions)."""
+    columns = 1024 // 8
+    return ((((row * 4 + bank) * 4 + bank_group) * 1 + rank) * columns) << 6
+
+
+def test_inter_bank_copy_reads_source_before_writing_destination():
+    dut = cs.ControllerUnderTest.make_generic_ddr(
+        ramulator.dram.DDR4_RowClone(org_preset="DDR4_8Gb_x8", timing_preset="DDR4_2400R", rank=1),
+        addr_mapper=ramulator.addr_mapper.RoBaRaCoCh(),
+    )
+    src = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=3, Column=0)
+    dst = dut.addr_vec(Rank=0, BankGroup=1, Bank=2, Row=7, Column=0)
+
+    dut.send_copy(_row_addr(bank_group=1, bank=2, row=7), _row_addr(bank_group=0, bank=0, row=3))
+    history = dut.run_until_idle(max_ticks=4096)
+
+    # The destination side (even its ACT) waits until RCSRC has read the source row
+    dut.assert_commands(["ACT", "RCSRC", "ACT", "RCDST"], history=history)
+    assert [item.addr_vec for item in history] == [src, src, dst, dst]
+    dut.assert_gap(0, 1, dut.timings["nRCD"], history=history)
+    dut.assert_gap(2, 3, dut.timings["nRCD"], history=history)
+
+    # The copy completes nPSM after RCDST issues
+    for _ in range(dut.timings["nPSM"] + 1):
+        dut.tick()
+    assert dut.stats()["num_copy_reqs_served"] == 1
+
+
+def test_crossed_inter_bank_copies_both_complete():
+    """Copies in opposite directions between two banks must not wait on each other's open rows."""
+    dut = cs.ControllerUnderTest.make_generic_ddr(
+        ramulator.dram.DDR4_RowClone(org_preset="DDR4_8Gb_x8", timing_preset="DDR4_2400R", rank=1),
+        addr_mapper=ramulator.addr_mapper.RoBaRaCoCh(),
+    )
+    dut.send_copy(_row_addr(bank=1, row=7), _row_addr(bank=0, row=3))
+    dut.send_copy(_row_addr(bank=0, row=11), _row_addr(bank=1, row=9))
+    history = dut.run_until_idle(max_ticks=16384)
+
+    issued = [(item.command, item.addr_vec[3], item.addr_vec[4]) for item in history]
+    for src_row, dst_bank, dst_row in [(3, 1, 7), (9, 0, 11)]:
+        src_bank = 1 - dst_bank
+        assert issued.index(("RCSRC", src_bank, src_row)) < issued.index(("RCDST", dst_bank, dst_row))
@@ -117,6 +117,14 @@ class ControllerUnderTest:
             raise ValueError(f"Unknown request type: {type_name}")
         self._cpp.send_request(self._request_type_ids[type_name], addr_vec, source_id)
 
+    def send_copy(self, addr: int, src_addr: int) -> None:
+        """Copy the row holding ``src_addr`` into the one holding ``addr``.
+
+        Both are intra-channel addresses mapped by the controller's addr_mapper
+        (a copy needs a real mapper to place its source in another bank).
+        """
+        self._cpp.send_copy(addr, src_addr)
+
     def priority_send(self, command_name: str, addr_vec: list[int]) -> None:
         if command_name not in self.command_names:
             raise ValueError(f"Unknown command: {command_name}")
@@ -139,6 +147,13 @@ class ControllerUnderTest:
     def is_idle(self) -> bool:
         return self._cpp.is_idle()
 
+    def pending_read_completions(self) -> int:
+        return self._cpp.pending_read_completions()
+
+    def completed_reads(self) -> list[list[int]]:
+        """addr_vecs of the reads completed so far, in completion order."""
+        return [list(addr_vec) for addr_vec in self._cpp.completed_reads()]
+
     def stats(self):
         return self._cpp.stats()
 
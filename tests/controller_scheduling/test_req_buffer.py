@@ -0,0 +1,74 @@
+import random
+
+import pytest
+
+from ramulator._ramulator_test import _ReqBufferUnderTest
+from ramulator._ramulator_test import _req_buffer_reenqueue_first
+
+
+pytestmark = pytest.mark.controller_scheduling
+
+PENDING, ACTIVE = 0, 1
+# Rank, BankGroup and Bank sizes, as for a two-rank DDR4 x8 channel
+BANK_RADIX = [2, 4, 4]
+NUM_BANKS = 2 * 4 * 4
+
+
+@pytest.mark.parametrize("num_requests", [15, 16, 32])
+def test_reenqueue_own_element_across_growth(num_requests):
+    # An active request that re-activates is enqueued from its own buffer (promote_to_active);
+    # at 16 and 32 entries the slab is full, so the enqueue grows it before copying the request.
+    addrs = _req_buffer_reenqueue_first(num_requests)
+    assert addrs == list(range(num_requests)) + [0]
+
+
+def flat_bank(addr_vec):
+    bank = 0
+    for level, size in enumerate(BANK_RADIX, start=1):
+        if addr_vec[level] < 0:
+            return None
+        bank = bank * size + addr_vec[level]
+    return bank
+
+
+def assert_chains_match_flat_scan(dut, addr_vecs):
+    for buffer in (PENDING, ACTIVE):
+        expected = {}
+        for addr in dut.addrs(buffer):
+            bank = flat_bank(addr_vecs[addr])
+            if bank is not None:
+                expected.setdefault(bank, []).append(addr)
+
+        assert sorted(dut.busy_banks(buffer)) == sorted(expected)
+        for bank in range(NUM_BANKS):
+            assert dut.bank_requests(buffer, bank) == expected.get(bank, [])
+            assert dut.bank_size(buffer, bank) == len(expected.get(bank, []))
+
+
+@pytest.mark.parametrize("seed", [1, 2, 3])
+def test_bank_chains_match_flat_scan(seed):
+    rng = random.Random(seed)
+    max_size = 48
+    dut = _ReqBufferUnderTest(BANK_RADIX, max_size)
+    addr_vecs = {}
+
+    for addr in range(2000):
+        buffer = rng.choice((PENDING, ACTIVE))
+        present = dut.addrs(buffer)
+        op = rng.random()
+        if op < 0.45 or not present:
+            # Leave a free slot for an active request to re-enqueue itself into
+            if len(dut.addrs(PENDING)) + len(dut.addrs(ACTIVE)) == max_size - 1:
+                continue
+            addr_vec = [0, rng.randrange(2), rng.randrange(4), rng.randrange(4), rng.randrange(8), 0]
+            if rng.random() < 0.1:
+                # All-bank maintenance requests are buffered but not chained
+                addr_vec[1:4] = [rng.randrange(2), -1, -1]
+            addr_vecs[addr] = addr_vec
+            assert dut.enqueue(PENDING, addr_vec, addr)
+        elif op < 0.7:
+            dut.remove(buffer, rng.choice(present))
+        else:
+            # Promotion, including an active request re-activating from the active buffer itself
+            assert dut.promote(buffer, rng.choice(present))
+        assert_chains_match_flat_scan(dut, addr_vecs)
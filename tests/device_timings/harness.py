@@ -54,9 +54,9 @@ class DeviceUnderTest:
 
     ALL = -1
 
-    def __init__(self, dram, channel_id: int = 0):
+    def __init__(self, dram, channel_id: int = 0, lazy_bank_state: bool = False):
         self.dram = dram
-        self._cpp = _CppDeviceUnderTest(dram.to_config(), channel_id=channel_id)
+        self._cpp = _CppDeviceUnderTest(dram.to_config(), channel_id=channel_id, lazy_bank_state=lazy_bank_state)
 
         metadata = _metadata_from_dram(dram, self._cpp)
         self.level_names = metadata["level_names"]
@@ -67,6 +67,11 @@ class DeviceUnderTest:
         self.tick_multiplier = metadata["tick_multiplier"]
         self.time_unit_ns = metadata["time_unit_ns"]
 
+    @property
+    def num_allocated_leaves(self) -> int:
+        """Deepest-level nodes holding timing state (all of them unless ``lazy_bank_state``)."""
+        return self._cpp.num_allocated_leaves
+
     def addr_vec(self, **levels) -> list[int]:
         """Build an addr_vec ``list[int]``.
 
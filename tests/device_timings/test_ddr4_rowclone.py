@@ -0,0 +1,64 @@
+import pytest
+
+import ramulator
+import tests.device_timings.harness as device_timings
+
+
+pytestmark = pytest.mark.device_timings
+
+
+def make_dut(**overrides):
+    """DDR4_RowClone 8Gb x8 @ 2400R, rank=1."""
+    dram = ramulator.dram.DDR4_RowClone(**{
+        "org_preset": "DDR4_8Gb_x8",
+        "timing_preset": "DDR4_2400R",
+        "rank": 1,
+        **overrides,
+    })
+    return device_timings.DeviceUnderTest(dram)
+
+
+def test_fpm_copy_requires_precharged_bank():
+    dut = make_dut()
+    a = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=12, Column=0)
+
+    assert dut.probe("RCFPM", a, clk=0).preq == "RCFPM"
+
+    dut.issue("ACT", a, clk=0)
+    assert dut.probe("RCFPM", a, clk=1).preq == "PREpb"
+
+
+def test_fpm_copy_occupies_bank_and_leaves_it_precharged():
+    dut = make_dut()
+    a = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=12, Column=0)
+    other_bg = dut.addr_vec(Rank=0, BankGroup=1, Bank=0, Row=12, Column=0)
+
+    assert dut.timings["nFPM"] == 2 * dut.timings["nRAS"] + dut.timings["nRP"]
+    dut.issue("RCFPM", a, clk=0)
+
+    assert dut.probe("RD", a, clk=1).preq == "ACT"
+    dut.assert_earliest_ready_at("ACT", a, dut.timings["nFPM"])
+    # Its activations count against other banks like an ACT
+    dut.assert_earliest_ready_at("ACT", other_bg, dut.timings["nRRDS"])
+
+
+def test_psm_transfer_occupies_internal_bus():
+    dut = make_dut()
+    src = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=12, Column=0)
+    dst = dut.addr_vec(Rank=0, BankGroup=1, Bank=2, Row=40, Column=0)
+    other = dut.addr_vec(Rank=0, BankGroup=2, Bank=0, Row=7, Column=0)
+
+    assert dut.probe("RCSRC", src, clk=0).preq == "ACT"
+    assert dut.timings["nPSM"] == 1024 // 8 * dut.timings["nCCDL"]
+
+    dut.issue("ACT", src, clk=0)
+    dut.issue("ACT", dst, clk=dut.timings["nRRDS"])
+    dut.issue("ACT", other, clk=2 * dut.timings["nRRDS"])
+    start = dut.timings["nRRDS"] + dut.timings["nRCD"]
+    dut.assert_earliest_ready_at("RCSRC", src, dut.timings["nRCD"])
+    dut.issue("RCSRC", src, clk=start)
+    # Both sides of one copy stream together; column accesses wait for the transfer
+    dut.assert_earliest_ready_at("RCDST", dst, start)
+    dut.issue("RCDST", dst, clk=start)
+    dut.assert_earliest_ready_at("RD", other, start + dut.timings["nPSM"])
+    dut.assert_earliest_ready_at("PREpb", dst, start + dut.timings["nPSM"] + dut.timings["nWR"])
@@ -0,0 +1,95 @@
+import pytest
+
+import ramulator
+import tests.device_timings.harness as device_timings
+
+
+pytestmark = pytest.mark.device_timings
+
+
+def make_dut(**overrides):
+    """DDR4_SALP 8Gb x8 @ 2400R (8 subarrays per bank), rank=1."""
+    dram = ramulator.dram.DDR4_SALP(**{
+        "org_preset": "DDR4_8Gb_x8",
+        "timing_preset": "DDR4_2400R",
+        "rank": 1,
+        **overrides,
+    })
+    return device_timings.DeviceUnderTest(dram)
+
+
+def test_act_to_other_subarray_of_open_bank_needs_no_precharge():
+    dut = make_dut()
+    a = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Subarray=0, Row=12, Column=0)
+    b = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Subarray=1, Row=40, Column=0)
+
+    dut.issue("ACT", a, clk=0)
+    probe = dut.probe("RD", b, clk=1)
+
+    assert probe.preq == "ACT"
+    assert probe.row_open is False
+    # Only the bank-group ACT spacing applies, not nRC
+    dut.assert_earliest_ready_at("ACT", b, dut.timings["nRRDL"])
+
+
+def test_row_conflict_within_subarray_requires_prepb():
+    dut = make_dut()
+    a = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Subarray=0, Row=12, Column=0)
+    conflict = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Subarray=0, Row=99, Column=0)
+
+    dut.issue("ACT", a, clk=0)
+    probe = dut.probe("RD", conflict, clk=dut.timings["nRCD"])
+
+    assert probe.preq == "PREpb"
+    assert probe.row_hit is False
+    assert probe.row_open is True
+
+
+def test_access_to_deselected_subarray_requires_sasel():
+    dut = make_dut()
+    a = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Subarray=0, Row=12, Column=0)
+    b = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Subarray=1, Row=40, Column=0)
+
+    dut.issue("ACT", a, clk=0)
+    dut.issue("ACT", b, clk=dut.timings["nRRDL"])
+    probe = dut.probe("RD", a, clk=dut.timings["nRCD"])
+
+    assert probe.preq == "SASEL"
+    assert probe.row_hit is True
+
+    sasel_clk = dut.timings["nRCD"]
+    dut.issue("SASEL", a, clk=sasel_clk)
+    dut.assert_earliest_ready_at("RD", a, sasel_clk + dut.timings["nSCD"])
+    assert dut.probe("RD", b, clk=sasel_clk + 1).preq == "SASEL"
+
+
+def test_prepb_closes_only_the_addressed_subarray():
+    dut = make_dut()
+    a = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Subarray=0, Row=12, Column=0)
+    b = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Subarray=1, Row=40, Column=0)
+
+    dut.issue("ACT", a, clk=0)
+    dut.issue("ACT", b, clk=dut.timings["nRRDL"])
+    dut.assert_earliest_ready_at("PREpb", a, dut.timings["nRAS"])
+    dut.issue("PREpb", a, clk=dut.timings["nRAS"])
+
+    closed = dut.probe("RD", a, clk=dut.timings["nRAS"] + 1)
+    still_open = dut.probe("RD", b, clk=dut.timings["nRAS"] + 1)
+
+    assert closed.preq == "ACT"
+    assert closed.row_open is False
+    assert still_open.preq == "RD"
+    assert still_open.row_hit is True
+
+
+def test_refab_requires_preab_while_any_subarray_is_open():
+    dut = make_dut()
+    b = dut.addr_vec(Rank=0, BankGroup=0, Bank=0, Subarray=1, Row=40, Column=0)
+    ref_addr = dut.addr_vec(Rank=0, BankGroup=dut.ALL, Bank=dut.ALL, Subarray=dut.ALL, Row=dut.ALL, Column=0)
+
+    dut.issue("ACT", b, clk=0)
+    assert dut.probe("REFab", ref_addr, clk=1).preq == "PREab"
+
+    dut.issue("PREab", ref_addr, clk=dut.timings["nRAS"])
+    assert dut.probe("REFab", ref_addr, clk=dut.timings["nRAS"] + 1).preq == "REFab"
+    assert dut.probe("RD", b, clk=dut.timings["nRAS"] + 1).preq == "ACT"
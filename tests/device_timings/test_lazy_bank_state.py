@@ -0,0 +1,65 @@
+import pytest
+
+import ramulator
+import tests.device_timings.harness as device_timings
+
+
+pytestmark = pytest.mark.device_timings
+
+
+def make_dut(lazy_bank_state):
+    """DDR4 8Gb x8 @ 2400R, rank=2 (32 banks)."""
+    dram = ramulator.dram.DDR4(
+        org_preset="DDR4_8Gb_x8",
+        timing_preset="DDR4_2400R",
+        rank=2,
+    )
+    return device_timings.DeviceUnderTest(dram, lazy_bank_state=lazy_bank_state)
+
+
+def test_refab_and_preab_allocate_no_banks():
+    dut = make_dut(lazy_bank_state=True)
+    assert dut.num_allocated_leaves == 0
+
+    # Neither constrains the Bank level of DDR4, so their wildcard walks allocate nothing
+    ref = dut.addr_vec(Rank=0, BankGroup=dut.ALL, Bank=dut.ALL)
+    dut.issue("REFab", ref, clk=0)
+    clk = dut.get_first_ready_clk("PREab", ref, start=1)
+    dut.issue("PREab", ref, clk=clk)
+    assert dut.num_allocated_leaves == 0
+
+    # Only the activated bank gets timing state
+    a = dut.addr_vec(Rank=1, BankGroup=2, Bank=3, Row=12, Column=0)
+    dut.issue("ACT", a, clk=clk + 1)
+    assert dut.num_allocated_leaves == 1
+
+
+def test_lazy_bank_state_matches_eager():
+    eager = make_dut(lazy_bank_state=False)
+    lazy = make_dut(lazy_bank_state=True)
+
+    a = eager.addr_vec(Rank=0, BankGroup=0, Bank=0, Row=12, Column=0)
+    b = eager.addr_vec(Rank=0, BankGroup=1, Bank=2, Row=40, Column=8)
+    c = eager.addr_vec(Rank=1, BankGroup=0, Bank=0, Row=7, Column=0)
+    ref = eager.addr_vec(Rank=0, BankGroup=eager.ALL, Bank=eager.ALL)
+    sequence = [
+        ("ACT", a), ("ACT", b), ("ACT", c), ("RD", a), ("WR", b), ("RD", c),
+        ("PREpb", a), ("PREab", ref), ("REFab", ref), ("ACT", a), ("RDA", a), ("ACT", b),
+    ]
+    probes = [("ACT", a), ("ACT", b), ("RD", c), ("PREpb", a), ("PREab", ref), ("REFab", ref)]
+
+    clk = 0
+    for command, addr in sequence:
+        start = clk
+        clk = eager.get_first_ready_clk(command, addr, start=start)
+        assert lazy.get_first_ready_clk(command, addr, start=start) == clk
+        eager.issue(command, addr, clk=clk)
+        lazy.issue(command, addr, clk=clk)
+        # Every probe agrees over the following cycles, including on banks the lazy state never allocated
+        for t in range(clk, clk + 400, 7):
+            for probe_command, probe_addr in probes:
+                assert lazy.probe(probe_command, probe_addr, t) == eager.probe(probe_command, probe_addr, t)
+        clk += 1
+
+    assert eager.num_allocated_leaves == 32
+    assert lazy.num_allocated_leaves == 3
@@ -13,6 +13,8 @@ def run_single(
     read_ratio=100,
     num_probes=10000,
     warmup=10000,
+    fast_forward=False,
+    scheduler="FRFCFS",
 ):
     """Run one simulation point and return sim.stats."""
     import ramulator
@@ -36,7 +38,7 @@ def run_single(
     ctrl_cls = getattr(ramulator.controller, cfg["controller_class"])
     ctrl = ctrl_cls(
         dram=dram,
-        scheduler=ramulator.scheduler.FRFCFS(),
+        scheduler=getattr(ramulator.scheduler, scheduler)(),
         row_policy=ramulator.row_policy.Open(),
         addr_mapper=ramulator.addr_mapper.PassThroughAddrMapper(),
         refresh_manager=ramulator.refresh_manager.NoRefresh(),
@@ -44,6 +46,7 @@ def run_single(
 
     mem = ramulator.memory_system.GenericDRAM(
         clock_ratio=1,
+        fast_forward=fast_forward,
         controllers=[ctrl],
         channel_mapper=ramulator.channel_mapper.PassThroughChannelMapper(),
     )
@@ -0,0 +1,86 @@
+"""Tier 1: A binary trace replays exactly like the text trace it was converted from, prefetched or not."""
+
+import random
+
+import pytest
+
+from ramulator.trace import convert, read_binary_trace
+from tests.smoke.testcases import STANDARDS
+from tests.utils import create_dram
+
+
+def _run_loadstore(trace_path, prefetch=True):
+    import ramulator
+
+    cfg = STANDARDS["DDR4"]
+    mem = ramulator.memory_system.GenericDRAM(
+        clock_ratio=1,
+        controllers=[
+            ramulator.controller.GenericDDR(
+                dram=create_dram(cfg),
+                scheduler=ramulator.scheduler.FRFCFS(),
+                row_policy=ramulator.row_policy.Open(),
+                addr_mapper=ramulator.addr_mapper.RoBaRaCoCh(),
+                refresh_manager=ramulator.refresh_manager.AllBank(),
+            )
+        ],
+        channel_mapper=ramulator.channel_mapper.CacheLineInterleave(),
+    )
+    frontend = ramulator.frontend.LoadStoreTrace(clock_ratio=1, path=str(trace_path), prefetch=prefetch)
+
+    sim = ramulator.Simulation(frontend, mem)
+    sim.run()
+    return sim.stats
+
+
+def _write_loadstore(path, num_lines):
+    rng = random.Random(2024)
+    with open(path, "w") as f:
+        for _ in range(num_lines):
+            op = "ST" if rng.random() < 0.3 else "LD"
+            f.write(f"{op} {hex(rng.randrange(1 << 30) & ~0x3F)}\n")
+
+
+@pytest.mark.smoke
+def test_binary_loadstore_trace_matches_text(tmp_path):
+    text = tmp_path / "trace.txt"
+    _write_loadstore(text, 20000)
+    binary = tmp_path / "trace.bin"
+    # Small blocks so that the replay crosses many block boundaries
+    assert convert(text, binary, block_records=1000) == 20000
+
+    assert _run_loadstore(binary) == _run_loadstore(text)
+
+
+@pytest.mark.smoke
+def test_prefetched_trace_matches_synchronous(tmp_path):
+    # Several stream blocks, the last one partial, so that the prefetcher wraps around
+    text = tmp_path / "trace.txt"
+    _write_loadstore(text, 10000)
+
+    assert _run_loadstore(text, prefetch=True) == _run_loadstore(text, prefetch=False)
+
+
+@pytest.mark.smoke
+@pytest.mark.parametrize(
+    "kind, lines",
+    [
+        ("loadstore", ["LD 0x12340", "ST 4096", "ZR 0x0", "CP 0x200000 0x400000", "LD 0xfffffffffc0", "LD 64"]),
+        ("readwrite", ["R 0,1,2,100,32", "W 0,0,3,200,16", "R 0,0,0,0,0"]),
+        ("inst", ["3 4096", "0 8192 64", "17 64", "2 0 -1"]),
+    ],
+)
+def test_binary_trace_round_trips(tmp_path, kind, lines):
+    text = tmp_path / "trace.txt"
+    text.write_text("\n".join(lines) + "\n")
+    binary = tmp_path / "trace.bin"
+    back = tmp_path / "back.txt"
+
+    convert(text, binary, kind=kind, block_records=2)
+    decoded_kind, records = read_binary_trace(binary)
+    assert decoded_kind == kind
+    assert len(records) == len(lines)
+
+    convert(binary, back)
+    convert(back, tmp_path / "again.bin", kind=kind, block_records=2)
+    assert (tmp_path / "again.bin").read_bytes() == binary.read_bytes()
@@ -0,0 +1,17 @@
+"""Tier 1: Idle-cycle fast-forward must not change simulation results."""
+
+import pytest
+
+from tests.smoke.runner import run_single
+from tests.smoke.testcases import STANDARDS
+
+
+@pytest.mark.smoke
+@pytest.mark.parametrize("standard", sorted(STANDARDS.keys()))
+def test_fast_forward_matches_cycle_by_cycle(standard):
+    """A low-intensity run yields identical stats with and without fast-forward."""
+    kwargs = dict(nop_counter=400, num_probes=100, warmup=100)
+    ref = run_single(standard, **kwargs)
+    ff = run_single(standard, fast_forward=True, **kwargs)
+
+    assert ff == ref
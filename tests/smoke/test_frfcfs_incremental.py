@@ -0,0 +1,17 @@
+"""Tier 1: FRFCFS-Incremental must schedule exactly like FRFCFS."""
+
+import pytest
+
+from tests.smoke.runner import run_single
+from tests.smoke.testcases import STANDARDS
+
+
+@pytest.mark.smoke
+@pytest.mark.parametrize("standard", sorted(STANDARDS.keys()))
+def test_frfcfs_incremental_matches_frfcfs(standard):
+    """A loaded mixed read/write run yields identical stats with either scheduler."""
+    kwargs = dict(nop_counter=0, read_ratio=70, num_probes=2000, warmup=2000)
+    ref = run_single(standard, **kwargs)
+    inc = run_single(standard, scheduler="FRFCFSIncremental", **kwargs)
+
+    assert inc == ref
@@ -0,0 +1,53 @@
+"""Tier 1: Processor traces parse the same on one thread as split across many."""
+
+import random
+
+import pytest
+
+from ramulator._ramulator_test import _load_inst_trace
+
+
+def _write_trace(path, num_lines, final_newline=True):
+    rng = random.Random(2024)
+    records = []
+    lines = []
+    for _ in range(num_lines):
+        bubble_count = rng.randrange(16)
+        load_addr = rng.randrange(1 << 32) & ~0x3F
+        store_addr = rng.randrange(1 << 32) & ~0x3F if rng.random() < 0.3 else -1
+        records.append((bubble_count, load_addr, store_addr))
+        # Mix decimal and hex addresses
+        fields = [str(bubble_count), hex(load_addr) if rng.random() < 0.5 else str(load_addr)]
+        if store_addr != -1:
+            fields.append(str(store_addr))
+        lines.append(" ".join(fields))
+    path.write_text("\n".join(lines) + ("\n" if final_newline else ""))
+    return records
+
+
+@pytest.mark.smoke
+@pytest.mark.parametrize("final_newline", [True, False])
+def test_parallel_parse_matches_serial(tmp_path, final_newline):
+    # Several MB, so that the file splits into multiple line-aligned ranges
+    trace = tmp_path / "trace.txt"
+    records = _write_trace(trace, 400000, final_newline=final_newline)
+    assert trace.stat().st_size > 4 << 20
+
+    serial = _load_inst_trace(str(trace), 1)
+    assert serial == records
+    for num_threads in (2, 3, 8):
+        assert _load_inst_trace(str(trace), num_threads) == serial
+
+
+@pytest.mark.smoke
+@pytest.mark.parametrize("num_threads", [1, 8])
+def test_malformed_line_reports_its_line_number(tmp_path, num_threads):
+    trace = tmp_path / "trace.txt"
+    _write_trace(trace, 400000)
+    lines = trace.read_text().splitlines()
+    # Near the end, in the last range when parsing in parallel
+    lines[389999] = "3 0x4z 0x80"
+    trace.write_text("\n".join(lines) + "\n")
+
+    with pytest.raises(RuntimeError, match="line 390000: invalid instruction"):
+        _load_inst_trace(str(trace), num_threads)
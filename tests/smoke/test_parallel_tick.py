@@ -0,0 +1,55 @@
+"""Tier 1: Ticking channels on a worker pool must not change simulation results."""
+
+import random
+
+import pytest
+
+from tests.smoke.testcases import STANDARDS
+from tests.utils import create_dram
+
+
+def _run_multichannel(trace_path, num_channels, num_threads):
+    import ramulator
+
+    cfg = STANDARDS["HBM3"]
+    controllers = [
+        ramulator.controller.HBM34(
+            dram=create_dram(cfg),
+            scheduler=ramulator.scheduler.FRFCFS(),
+            row_policy=ramulator.row_policy.Open(),
+            addr_mapper=ramulator.addr_mapper.RoBaRaCoCh(),
+            refresh_manager=ramulator.refresh_manager.HBM34PerBankRefresh(),
+        )
+        for _ in range(num_channels)
+    ]
+    mem = ramulator.memory_system.GenericDRAM(
+        clock_ratio=1,
+        num_threads=num_threads,
+        controllers=controllers,
+        channel_mapper=ramulator.channel_mapper.CacheLineInterleave(),
+    )
+    frontend = ramulator.frontend.LoadStoreTrace(clock_ratio=1, path=str(trace_path))
+
+    sim = ramulator.Simulation(frontend, mem)
+    sim.run()
+    return sim.stats
+
+
+@pytest.mark.smoke
+@pytest.mark.parametrize("num_threads", [2, 4])
+def test_parallel_tick_matches_serial(tmp_path, num_threads):
+    """An 8-channel HBM3 run yields identical stats with and without worker threads."""
+    rng = random.Random(12345)
+    trace = tmp_path / "trace.txt"
+    with open(trace, "w") as f:
+        for _ in range(20000):
+            op = "ST" if rng.random() < 0.3 else "LD"
+            f.write(f"{op} {hex(rng.randrange(1 << 30) & ~0x3F)}\n")
+
+    ref = _run_multichannel(trace, num_channels=8, num_threads=1)
+    par = _run_multichannel(trace, num_channels=8, num_threads=num_threads)
+
+    # The pool is created even on hosts with fewer cores than requested threads
+    assert ref["memory_system"].pop("num_threads") == 1
+    assert par["memory_system"].pop("num_threads") == num_threads
+    assert par == ref
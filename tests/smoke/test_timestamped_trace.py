@@ -0,0 +1,77 @@
+"""Tier 1: TimestampedTrace injects requests at their timestamps and measures end-to-end latency."""
+
+import random
+
+import pytest
+
+from tests.smoke.testcases import STANDARDS
+from tests.utils import create_dram
+
+
+def _write_trace(path, num_requests, mean_gap):
+    rng = random.Random(2024)
+    timestamp = 0.0
+    with open(path, "w") as f:
+        for _ in range(num_requests):
+            timestamp += rng.expovariate(1 / mean_gap)
+            op = "ST" if rng.random() < 0.3 else "LD"
+            f.write(f"{timestamp:.1f} {op} {hex(rng.randrange(1 << 30) & ~0x3F)}\n")
+    return timestamp
+
+
+def _run(trace_path, fast_forward=False, **kwargs):
+    import ramulator
+
+    cfg = STANDARDS["DDR4"]
+    mem = ramulator.memory_system.GenericDRAM(
+        clock_ratio=1,
+        fast_forward=fast_forward,
+        controllers=[
+            ramulator.controller.GenericDDR(
+                dram=create_dram(cfg),
+                scheduler=ramulator.scheduler.FRFCFS(),
+                row_policy=ramulator.row_policy.Open(),
+                addr_mapper=ramulator.addr_mapper.RoBaRaCoCh(),
+                refresh_manager=ramulator.refresh_manager.AllBank(),
+            )
+        ],
+        channel_mapper=ramulator.channel_mapper.CacheLineInterleave(),
+    )
+    frontend = ramulator.frontend.TimestampedTrace(clock_ratio=1, path=str(trace_path), **kwargs)
+
+    sim = ramulator.Simulation(frontend, mem)
+    sim.run()
+    return sim.stats
+
+
+@pytest.mark.smoke
+def test_open_loop_replay_follows_timestamps(tmp_path):
+    trace = tmp_path / "trace.txt"
+    last_timestamp = _write_trace(trace, 5000, mean_gap=50)
+
+    stats = _run(trace)
+    fe = stats["frontend"]
+    assert fe["num_requests_injected"] == 5000
+    assert fe["num_requests_completed"] == 5000
+    # A light load barely queues, and the replay lasts as long as the trace
+    assert fe["avg_queue_wait"] < 1
+    assert fe["avg_latency"] > 0
+    cycles = stats["memory_system"]["controller"]["cycles"]
+    assert last_timestamp <= cycles < last_timestamp * 1.1
+
+    # Idle stretches between timestamps are skipped without changing the results
+    assert _run(trace, fast_forward=True) == stats
+
+
+@pytest.mark.smoke
+def test_time_compression_raises_load(tmp_path):
+    trace = tmp_path / "trace.txt"
+    _write_trace(trace, 5000, mean_gap=50)
+
+    base = _run(trace)["frontend"]
+    compressed = _run(trace, time_compression=50)["frontend"]
+    assert compressed["num_requests_completed"] == 5000
+    # At one request per cycle on average, requests back up in the frontend queue
+    assert compressed["max_pending_requests"] > base["max_pending_requests"]
+    assert compressed["avg_queue_wait"] > base["avg_queue_wait"]
+    assert compressed["avg_latency"] > base["avg_latency"]
@@ -0,0 +1,104 @@
+"""Tier 1: LoadStoreTrace streams its trace lazily, replays it once, and reports malformed lines."""
+
+import pytest
+
+from tests.smoke.testcases import STANDARDS
+from tests.utils import create_dram
+
+
+def _make_sim(trace_path, **kwargs):
+    import ramulator
+
+    cfg = STANDARDS["DDR4"]
+    mem = ramulator.memory_system.GenericDRAM(
+        clock_ratio=1,
+        controllers=[
+            ramulator.controller.GenericDDR(
+                dram=create_dram(cfg),
+                scheduler=ramulator.scheduler.FRFCFS(),
+                row_policy=ramulator.row_policy.Open(),
+                addr_mapper=ramulator.addr_mapper.RoBaRaCoCh(),
+                refresh_manager=ramulator.refresh_manager.AllBank(),
+            )
+        ],
+        channel_mapper=ramulator.channel_mapper.CacheLineInterleave(),
+    )
+    frontend = ramulator.frontend.LoadStoreTrace(clock_ratio=1, path=str(trace_path), **kwargs)
+    return ramulator.Simulation(frontend, mem)
+
+
+@pytest.mark.smoke
+@pytest.mark.parametrize("prefetch", [True, False])
+def test_malformed_first_block_raises(tmp_path, prefetch):
+    # The error surfaces while the first block is decoded, inside the frontend's construction
+    trace = tmp_path / "trace.txt"
+    trace.write_text("LD 0x40\nST 0x80\nLD 0xzz\nLD 0xc0\n")
+
+    with pytest.raises(RuntimeError, match="line 3: invalid address '0xzz'"):
+        _make_sim(trace, prefetch=prefetch)
+
+
+def _lines(num_lines):
+    # Deterministic LD/ST mix at cache-line aligned addresses
+    return [f"{'ST' if i % 3 == 0 else 'LD'} {hex((i * 0x9E3779B1) % (1 << 30) & ~0x3F)}" for i in range(num_lines)]
+
+
+def _num_requests(stats):
+    mem = stats["memory_system"]
+    return mem["total_num_read_requests"] + mem["total_num_write_requests"]
+
+
+def _run(trace_path, **kwargs):
+    sim = _make_sim(trace_path, **kwargs)
+    sim.run()
+    return sim.stats
+
+
+@pytest.mark.smoke
+@pytest.mark.parametrize("prefetch", [True, False])
+@pytest.mark.parametrize("num_lines", [10, 5000])
+def test_replays_one_pass(tmp_path, num_lines, prefetch):
+    # Shorter than one decode block (4096 records), and longer so that decoding wraps around
+    # before the replay learns the trace length at the end of its first pass
+    trace = tmp_path / "trace.txt"
+    trace.write_text("\n".join(_lines(num_lines)) + "\n")
+
+    assert _num_requests(_run(trace, prefetch=prefetch)) == num_lines
+
+
+@pytest.mark.smoke
+def test_line_endings_do_not_matter(tmp_path):
+    lines = _lines(5000)
+    lf = tmp_path / "lf.txt"
+    lf.write_text("\n".join(lines) + "\n")
+    crlf = tmp_path / "crlf.txt"
+    crlf.write_bytes(("\r\n".join(lines) + "\r\n").encode())
+    no_final_newline = tmp_path / "no_final_newline.txt"
+    no_final_newline.write_text("\n".join(lines))
+
+    ref = _run(lf)
+    assert _num_requests(ref) == 5000
+    assert _run(crlf) == ref
+    assert _run(no_final_newline) == ref
+
+
+@pytest.mark.smoke
+def test_empty_trace_finishes(tmp_path):
+    trace = tmp_path / "trace.txt"
+    trace.write_text("")
+
+    assert _num_requests(_run(trace)) == 0
+
+
+@pytest.mark.smoke
+@pytest.mark.parametrize("prefetch", [True, False])
+def test_malformed_line_reports_its_line_number(tmp_path, prefetch):
+    # Past the first block: reported during the replay, once it reaches the line
+    lines = _lines(5000)
+    lines[4499] = "LD"
+    trace = tmp_path / "trace.txt"
+    trace.write_text("\n".join(lines) + "\n")
+
+    sim = _make_sim(trace, prefetch=prefetch)
+    with pytest.raises(RuntimeError, match="line 4500: expected 2 tokens, got 1"):
+        sim.run()
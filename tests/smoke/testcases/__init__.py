@@ -2,6 +2,8 @@
 
 from tests.smoke.testcases.ddr3 import CONFIG as DDR3_CONFIG
 from tests.smoke.testcases.ddr4 import CONFIG as DDR4_CONFIG
+from tests.smoke.testcases.ddr4_salp import CONFIG as DDR4_SALP_CONFIG
+from tests.smoke.testcases.ddr4_rowclone import CONFIG as DDR4_ROWCLONE_CONFIG
 from tests.smoke.testcases.ddr5 import CONFIG as DDR5_CONFIG
 from tests.smoke.testcases.hbm import CONFIG as HBM1_CONFIG
 from tests.smoke.testcases.hbm2 import CONFIG as HBM2_CONFIG
@@ -15,6 +17,8 @@ from tests.smoke.testcases.gddr7 import CONFIG as GDDR7_CONFIG
 STANDARDS = {
     "DDR3": DDR3_CONFIG,
     "DDR4": DDR4_CONFIG,
+    "DDR4_SALP": DDR4_SALP_CONFIG,
+    "DDR4_RowClone": DDR4_ROWCLONE_CONFIG,
     "DDR5": DDR5_CONFIG,
     "HBM1": HBM1_CONFIG,
     "HBM2": HBM2_CONFIG,
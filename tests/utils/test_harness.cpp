@@ -1,12 +1,15 @@
 #include <nanobind/nanobind.h>
 #include <nanobind/stl/map.h>
 #include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
 #include <nanobind/stl/vector.h>
 
 #include <fmt/format.h>
+#include <array>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 
 #include "ramulator/base/factory.h"
 #include "ramulator/controller/controller_base.h"
@@ -15,6 +18,7 @@
 #include "ramulator/dram/device.h"
 #include "ramulator/dram/dram_spec.h"
 #include "ramulator/frontend/i_frontend.h"
+#include "ramulator/frontend/trace/inst_trace.h"
 #include "ramulator/memory_system/i_memory_system.h"
 #include "ramulator/python/binding_utils.h"
 
@@ -22,10 +26,11 @@
 
 class DeviceUnderTestCpp {
  public:
-  explicit DeviceUnderTestCpp(nb::dict dram_config, int channel_id) {
+  explicit DeviceUnderTestCpp(nb::dict dram_config, int channel_id, bool lazy_bank_state) {
     ConfigNode cfg = py_to_confignode(dram_config);
     std::string dram_impl = cfg["impl"].as<std::string>();
-    m_device.init(DRAMSpec::create(dram_impl, ConfigNode(ConfigNode::Map{{"dram", std::move(cfg)}})));
+    m_device.init(DRAMSpec::create(dram_impl, ConfigNode(ConfigNode::Map{{"dram", std::move(cfg)}})),
+                  lazy_bank_state);
     m_device.set_channel_id(channel_id);
   }
 
@@ -45,6 +50,10 @@ class DeviceUnderTestCpp {
     return spec().get_timing_value(name);
   }
 
+  size_t num_allocated_leaves() const {
+    return m_device.m_timing.get_num_allocated_leaves();
+  }
+
   nb::dict probe(const std::string& command_name, const AddrVec_t& addr_vec, Clk_t clk) {
     validate_addr_vec_size(spec(), addr_vec);
     int cmd = spec().get_command_id(command_name);
@@ -232,11 +241,12 @@ class ControllerUnderTestCpp {
     bool read_like = is_read_like_request(type_id);
     if (read_like) {
       m_read_completions_pending++;
-      req.callback = [this](Request&) {
+      req.callback = [this](Request& done) {
         if (m_read_completions_pending == 0) {
           throw std::runtime_error("ControllerUnderTest read completion accounting underflow");
         }
         m_read_completions_pending--;
+        m_completed_reads.push_back(done.addr_vec);
       };
     }
 
@@ -253,6 +263,19 @@ class ControllerUnderTestCpp {
     }
   }
 
+  // Copy the row holding src_addr into the one holding addr (intra-channel addresses, mapped by the
+  // controller's addr_mapper)
+  void send_copy(Addr_t addr, Addr_t src_addr) {
+    Request req(addr, Request::Type::Copy);
+    req.intra_channel_addr = addr;
+    req.src_addr = src_addr;
+    req.src_intra_channel_addr = src_addr;
+    if (!m_controller->send(req)) {
+      throw std::runtime_error("ControllerUnderTest failed to enqueue copy request");
+    }
+    m_command_outstanding++;
+  }
+
   void priority_send(const std::string& command_name, const AddrVec_t& addr_vec) {
     validate_addr_vec_size(spec(), addr_vec);
     int command = spec().get_command_id(command_name);
@@ -295,6 +318,15 @@ class ControllerUnderTestCpp {
     return m_command_outstanding == 0 && m_read_completions_pending == 0;
   }
 
+  size_t pending_read_completions() const {
+    return m_read_completions_pending;
+  }
+
+  // addr_vecs of completed reads, in completion order
+  const std::vector<AddrVec_t>& completed_reads() const {
+    return m_completed_reads;
+  }
+
   nb::dict stats() {
     if (!m_stats_finalized) {
       m_memory_system->IMemorySystem::finalize();
@@ -311,6 +343,7 @@ class ControllerUnderTestCpp {
   IControllerValidationHook* m_validation_hook = nullptr;
   size_t m_command_outstanding = 0;
   size_t m_read_completions_pending = 0;
+  std::vector<AddrVec_t> m_completed_reads;
   bool m_stats_finalized = false;
 
   const DRAMSpec& spec() const {
@@ -344,16 +377,124 @@ class ControllerUnderTestCpp {
   }
 };
 
+// ---- ReqBuffer ----
+
+// Fill a buffer with num_requests reads (addr 0, 1, ...) up to its slab capacity, then enqueue
+// its first element into it again, which grows the slab. Returns the addresses in buffer order.
+std::vector<Addr_t> req_buffer_reenqueue_first(int num_requests) {
+  ReqBuffer buffer(num_requests + 1);
+  for (int i = 0; i < num_requests; i++) {
+    buffer.enqueue(Request(static_cast<Addr_t>(i), Request::Type::Read));
+  }
+  buffer.enqueue(*buffer.begin());
+
+  std::vector<Addr_t> addrs;
+  for (auto& req : buffer) {
+    addrs.push_back(req.addr);
+  }
+  return addrs;
+}
+
+// A pending (0) and an active (1) bank-indexed buffer, moved between as ControllerBase does
+class ReqBufferUnderTestCpp {
+ public:
+  ReqBufferUnderTestCpp(std::vector<int> bank_radix, size_t max_size)
+      : m_buffers{ReqBuffer(max_size), ReqBuffer(max_size)} {
+    for (auto& buffer : m_buffers) {
+      buffer.index_by_bank(bank_radix);
+    }
+  }
+
+  bool enqueue(int buffer, const AddrVec_t& addr_vec, Addr_t addr) {
+    Request req(addr_vec, Request::Type::Read);
+    req.addr = addr;
+    return get(buffer).enqueue(req);
+  }
+
+  // Remove the oldest request with addr
+  void remove(int buffer, Addr_t addr) {
+    get(buffer).remove(find(buffer, addr));
+  }
+
+  // Move the oldest request with addr to the active buffer, as promote_to_active() does (also
+  // from the active buffer itself)
+  bool promote(int buffer, Addr_t addr) {
+    auto it = find(buffer, addr);
+    if (!m_buffers[1].enqueue(*it)) {
+      return false;
+    }
+    get(buffer).remove(it);
+    return true;
+  }
+
+  std::vector<Addr_t> addrs(int buffer) {
+    std::vector<Addr_t> addrs;
+    for (auto& req : get(buffer)) {
+      addrs.push_back(req.addr);
+    }
+    return addrs;
+  }
+
+  std::vector<Addr_t> bank_requests(int buffer, int flat_bank_id) const {
+    std::vector<Addr_t> addrs;
+    for (const Request& req : m_buffers.at(buffer).bank_requests(flat_bank_id)) {
+      addrs.push_back(req.addr);
+    }
+    return addrs;
+  }
+
+  int bank_size(int buffer, int flat_bank_id) const {
+    return m_buffers.at(buffer).bank_size(flat_bank_id);
+  }
+
+  std::vector<int> busy_banks(int buffer) const {
+    return m_buffers.at(buffer).busy_banks();
+  }
+
+ private:
+  std::array<ReqBuffer, 2> m_buffers;
+
+  ReqBuffer& get(int buffer) {
+    return m_buffers.at(buffer);
+  }
+
+  ReqBuffer::iterator find(int buffer, Addr_t addr) {
+    for (auto it = get(buffer).begin(); it != get(buffer).end(); ++it) {
+      if (it->addr == addr) {
+        return it;
+      }
+    }
+    throw std::runtime_error(fmt::format("ReqBufferUnderTest: no request with addr {}", addr));
+  }
+};
+
+// ---- Trace loading ----
+
+// Load a processor trace as SimpleO3/BHO3 do, as (bubble_count, load_addr, store_addr) tuples
+std::vector<std::tuple<int, Addr_t, Addr_t>> load_inst_trace_records(const std::string& path, int num_threads) {
+  std::vector<InstRecord> records;
+  load_inst_trace(path, records, num_threads);
+
+  std::vector<std::tuple<int, Addr_t, Addr_t>> tuples;
+  tuples.reserve(records.size());
+  for (const auto& r : records) {
+    tuples.emplace_back(r.bubble_count, r.load_addr, r.store_addr);
+  }
+  return tuples;
+}
+
 // ---- nanobind module ----
 
 NB_MODULE(_ramulator_test, m) {
   m.doc() = "Ramulator2 test harness bindings";
 
   nb::class_<DeviceUnderTestCpp>(m, "_DeviceUnderTest")
-      .def(nb::init<nb::dict, int>(), nb::arg("dram_config"), nb::arg("channel_id") = 0)
+      .def(nb::init<nb::dict, int, bool>(), nb::arg("dram_config"), nb::arg("channel_id") = 0,
+           nb::arg("lazy_bank_state") = false)
       .def_prop_ro("level_names", &DeviceUnderTestCpp::level_names)
       .def_prop_ro("command_names", &DeviceUnderTestCpp::command_names)
       .def_prop_ro("timings", &DeviceUnderTestCpp::timings)
+      .def_prop_ro("num_allocated_leaves", &DeviceUnderTestCpp::num_allocated_leaves)
       .def("timing", &DeviceUnderTestCpp::timing, nb::arg("name"))
       .def("probe", &DeviceUnderTestCpp::probe, nb::arg("command"), nb::arg("addr_vec"), nb::arg("clk"))
       .def("issue", &DeviceUnderTestCpp::issue, nb::arg("command"), nb::arg("addr_vec"), nb::arg("clk"));
@@ -366,8 +507,24 @@ NB_MODULE(_ramulator_test, m) {
       .def("timing", &ControllerUnderTestCpp::timing, nb::arg("name"))
       .def("send_request", &ControllerUnderTestCpp::send_request,
            nb::arg("type_id"), nb::arg("addr_vec"), nb::arg("source_id") = 0)
+      .def("send_copy", &ControllerUnderTestCpp::send_copy, nb::arg("addr"), nb::arg("src_addr"))
       .def("priority_send", &ControllerUnderTestCpp::priority_send, nb::arg("command"), nb::arg("addr_vec"))
       .def("tick", &ControllerUnderTestCpp::tick)
       .def("is_idle", &ControllerUnderTestCpp::is_idle)
+      .def("pending_read_completions", &ControllerUnderTestCpp::pending_read_completions)
+      .def("completed_reads", &ControllerUnderTestCpp::completed_reads)
       .def("stats", &ControllerUnderTestCpp::stats);
+
+  nb::class_<ReqBufferUnderTestCpp>(m, "_ReqBufferUnderTest")
+      .def(nb::init<std::vector<int>, size_t>(), nb::arg("bank_radix"), nb::arg("max_size"))
+      .def("enqueue", &ReqBufferUnderTestCpp::enqueue, nb::arg("buffer"), nb::arg("addr_vec"), nb::arg("addr"))
+      .def("remove", &ReqBufferUnderTestCpp::remove, nb::arg("buffer"), nb::arg("addr"))
+      .def("promote", &ReqBufferUnderTestCpp::promote, nb::arg("buffer"), nb::arg("addr"))
+      .def("addrs", &ReqBufferUnderTestCpp::addrs, nb::arg("buffer"))
+      .def("bank_requests", &ReqBufferUnderTestCpp::bank_requests, nb::arg("buffer"), nb::arg("flat_bank_id"))
+      .def("bank_size", &ReqBufferUnderTestCpp::bank_size, nb::arg("buffer"), nb::arg("flat_bank_id"))
+      .def("busy_banks", &ReqBufferUnderTestCpp::busy_banks, nb::arg("buffer"));
+
+  m.def("_req_buffer_reenqueue_first", &req_buffer_reenqueue_first, nb::arg("num_requests"));
+  m.def("_load_inst_trace", &load_inst_trace_records, nb::arg("path"), nb::arg("num_threads"));
 }